@@ -3,10 +3,20 @@
 struct GameConfig {
     // Node settings
     static constexpr float NODE_DEFAULT_SPEED = 75.0f;
+    static constexpr float NODE_ROTATION_SPEED = 30.0f;
+    static constexpr float NODE_RETIRE_MARGIN = 200.0f;
+    // Push speed per pixel of overlap between separating nodes, in 1/s
+    static constexpr float NODE_SEPARATION_STRENGTH = 4.0f;
+    static constexpr int NODE_SEPARATION_MAX_NEIGHBORS = 8;
+    // Nodes per parallel chunk; smaller crowds are separated on the calling thread
+    static constexpr int NODE_SEPARATION_CHUNK = 1024;
 
     // Pickup settings
     static constexpr float PICKUP_LIFETIME = 10.0f;
     static constexpr float PICKUP_COLLECT_DELAY = 0.1f;
+    static constexpr int PICKUP_MERGE_THRESHOLD = 256;
+    static constexpr float PICKUP_MERGE_RADIUS_SCALE = 4.0f;
+    static constexpr float PICKUP_MERGE_MIN_AGE = 0.5f;
 
     // Points settings
     static constexpr int POINTS_MULTIPLIER_MAX = 5;
@@ -25,9 +35,86 @@ struct GameConfig {
     static constexpr float DAMAGE_PER_TICK_DEFAULT = 50.0f;
     static constexpr int DAMAGE_UPGRADE_COST = 60;
     static constexpr float DAMAGE_UPGRADE_AMOUNT = 5.0f;
+    // Death explosions resolved per tick; the rest carry over to the next tick
+    static constexpr int CHAIN_EXPLOSIONS_PER_TICK = 256;
 
     // Boss and level settings
     static constexpr float BOSS_SPEED = 35.0f;
     static constexpr float BOSS_HP_BASE = 200.0f;
     static constexpr float LEVEL_DURATION = 60.0f;
+
+    // Boss projectiles
+    static constexpr int PROJECTILE_CAPACITY = 8192;
+    static constexpr float PROJECTILE_SPEED = 180.0f;
+    static constexpr float PROJECTILE_LIFETIME = 6.0f;
+    static constexpr float PROJECTILE_RADIUS_SCALE = 0.006f;  // of screen height
+    static constexpr float PROJECTILE_HEALTH_COST = 1.0f;
+    // Lifetimes are tracked on a timing wheel of WHEEL_SLOTS ticks of WHEEL_TICK seconds
+    static constexpr int PROJECTILE_WHEEL_SLOTS = 256;
+    static constexpr float PROJECTILE_WHEEL_TICK = 1.0f / 32.0f;
+    static constexpr float BOSS_ATTACK_INTERVAL = 2.5f;
+    static constexpr int BOSS_RADIAL_COUNT = 24;
+    static constexpr int BOSS_SPIRAL_ARMS = 4;
+    static constexpr int BOSS_SPIRAL_VOLLEYS = 30;
+    static constexpr float BOSS_SPIRAL_VOLLEY_INTERVAL = 0.08f;
+    static constexpr float BOSS_SPIRAL_TURN = 11.0f;  // degrees per volley
+    static constexpr int BOSS_AIMED_COUNT = 5;
+    static constexpr float BOSS_AIMED_SPREAD = 30.0f;  // degrees across the fan
+    // Below this share of its HP the boss script switches to its enraged cycle
+    static constexpr float BOSS_ENRAGE_HEALTH = 0.5f;
+    static constexpr float BOSS_ENRAGED_ATTACK_INTERVAL = 1.5f;
+    static constexpr int BOSS_MINION_COUNT = 8;
+
+    // Scripted ring waves, from RING_WAVE_FIRST_LEVEL on; radius is a fraction of screen height
+    static constexpr int RING_WAVE_FIRST_LEVEL = 3;
+    static constexpr float RING_WAVE_INTERVAL = 12.0f;
+    static constexpr int RING_WAVE_COUNT = 16;
+    static constexpr float RING_WAVE_RADIUS = 1.1f;
+
+    // Spawn schedule, precomputed one segment at a time from a single seed
+    static constexpr float SPAWN_SCHEDULE_SEGMENT = 60.0f;
+    static constexpr float SPAWN_BURST_INTERVAL = 9.0f;
+    static constexpr int SPAWN_BURST_MIN = 3;
+    static constexpr int SPAWN_BURST_MAX = 6;
+    static constexpr int SPAWN_FORMATION_FIRST_LEVEL = 2;
+    static constexpr float SPAWN_FORMATION_INTERVAL = 20.0f;
+    static constexpr int SPAWN_FORMATION_BASE = 24;
+    static constexpr int SPAWN_FORMATION_PER_LEVEL = 8;
+    static constexpr int SPAWN_FORMATION_MAX = 400;
+    static constexpr float SPAWN_FORMATION_SPACING = 0.09f;  // of screen height
+
+    // Overload mode: the spawn rate starts at OVERLOAD_START_RATE nodes/s and doubles every
+    // OVERLOAD_DOUBLING_TIME seconds, arriving in batches no more often than OVERLOAD_MIN_INTERVAL
+    static constexpr float OVERLOAD_START_RATE = 2.0f;
+    static constexpr float OVERLOAD_DOUBLING_TIME = 10.0f;
+    static constexpr float OVERLOAD_MIN_INTERVAL = 1.0f / 60.0f;
+    static constexpr float OVERLOAD_SCHEDULE_SEGMENT = 1.0f;
+    static constexpr int OVERLOAD_MAX_NODES = 100000;
+
+    // Simulation thread: fixed step, and how far behind it may fall before it skips ahead
+    static constexpr float SIMULATION_TIME_STEP = 1.0f / 120.0f;
+    static constexpr float SIMULATION_MAX_LAG = 0.25f;
+    static constexpr int SIMULATION_INPUT_CAPACITY = 256;
+
+    // Rewind buffer: seconds of history kept, frames between full keyframes, and a memory cap
+    static constexpr float REWIND_WINDOW = 10.0f;
+    static constexpr int REWIND_KEYFRAME_INTERVAL = 60;
+    static constexpr int REWIND_MAX_BYTES = 64 * 1024 * 1024;
+
+    // Mid-run checkpoints: seconds of simulation between writes
+    static constexpr float CHECKPOINT_INTERVAL = 5.0f;
+
+    // Level scaling (baked into LevelTable)
+    static constexpr int LEVEL_TABLE_SIZE = 100;
+    static constexpr float SPAWN_INTERVAL_BASE = 2.0f;
+    static constexpr float SPAWN_INTERVAL_STEP = 0.15f;
+    static constexpr float SPAWN_INTERVAL_MIN = 0.5f;
+    static constexpr float NODE_HP_SCALE_PER_LEVEL = 0.2f;
+    static constexpr float HEALTH_DEPLETION_SCALE_PER_LEVEL = 0.2f;
+    static constexpr float HEALTH_COST_SCALE_PER_LEVEL = 0.2f;
+    static constexpr float BOSS_HP_PER_LEVEL = 100.0f;
+
+    // Autoplay settings
+    static constexpr float AUTOPLAY_CURSOR_SPEED = 1400.0f;
+    static constexpr int AUTOPLAY_MAX_CANDIDATES = 48;
 };
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Every coefficient that changes with the level, resolved once per level.
+struct LevelParams {
+    float spawnInterval;
+    float nodeHPScale;
+    float healthDepletionScale;
+    float healthCostScale;
+    float bossHP;
+};
+
+// Per-level difficulty curve. The default table is baked from GameConfig;
+// LoadFromFile overrides individual levels so balance can change without a rebuild.
+class LevelTable {
+   private:
+    std::vector<LevelParams> m_Levels;
+
+   public:
+    LevelTable();
+
+    // Levels past the end of the table reuse the last entry.
+    const LevelParams& Get(int level) const;
+    int GetLevelCount() const;
+
+    void Set(int level, const LevelParams& params);
+
+    // Text format, one level per line: level spawnInterval nodeHPScale
+    // healthDepletionScale healthCostScale bossHP. Lines starting with # are ignored.
+    bool LoadFromFile(const std::string& filePath);
+
+    static LevelParams ComputeDefault(int level);
+    static const LevelTable& Default();
+};
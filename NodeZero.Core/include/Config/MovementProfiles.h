@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Enums/MovementBehavior.h"
+
+// Every behavior is one row of parameters for the same path:
+//   distance(t) = speed ramping from initialSpeed by acceleration until it reaches speedLimit
+//   along       = coilRadius * sin(coilFrequency * t)
+//   lateral     = waveAmplitude * sin(waveFrequency * t) + coilRadius * (1 - cos(coilFrequency * t))
+// so all closed-form behaviors evaluate without branching on the behavior. Speeds are factors
+// of the node's base speed, lengths are in node sizes. Behaviors with a turnRate also steer
+// toward the cursor for steerDuration seconds after spawning.
+struct MovementProfile {
+    int unlockLevel;
+    float initialSpeed;
+    float acceleration;
+    float speedLimit;
+    float waveAmplitude;
+    float waveFrequency;
+    float coilRadius;
+    float coilFrequency;
+    float turnRate;
+    float steerDuration;
+};
+
+// Indexed by MovementBehavior.
+struct MovementProfiles {
+    static constexpr int COUNT = 6;
+
+    static constexpr MovementProfile TABLE[COUNT] = {
+        // unlock  initial  accel   limit  waveAmp  waveFreq  coil   coilFreq  turnRate  steer
+        {1,        1.0f,    0.0f,   1.0f,  0.0f,    0.0f,     0.0f,  0.0f,     0.0f,     0.0f},  // Linear
+        {2,        1.0f,    0.0f,   1.0f,  2.5f,    3.0f,     0.0f,  0.0f,     0.0f,     0.0f},  // SineWave
+        {3,        0.5f,    0.5f,   2.0f,  0.0f,    0.0f,     0.0f,  0.0f,     0.0f,     0.0f},  // Accelerate
+        {4,        2.0f,    -0.5f,  0.5f,  0.0f,    0.0f,     0.0f,  0.0f,     0.0f,     0.0f},  // Decelerate
+        {5,        1.0f,    0.0f,   1.0f,  0.0f,    0.0f,     1.5f,  4.0f,     0.0f,     0.0f},  // Spiral
+        {7,        1.0f,    0.0f,   1.0f,  0.0f,    0.0f,     0.0f,  0.0f,     90.0f,    4.0f},  // Homing
+    };
+
+    static constexpr const MovementProfile& Get(MovementBehavior behavior) {
+        return TABLE[static_cast<int>(behavior)];
+    }
+
+    static constexpr uint32_t Bit(MovementBehavior behavior) {
+        return 1u << static_cast<int>(behavior);
+    }
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Config/MovementProfiles.h"
+#include "Enums/NodeShape.h"
+
+enum class NodeRenderRoutine : uint8_t {
+    Circle,
+    Square,
+    Hexagon
+};
+
+struct NodeColor {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+};
+
+// Everything that differs between node shapes. Max HP is hpBase + hpPerSize * size,
+// destruction points are points + pointsPerLevel * level.
+struct NodeArchetype {
+    float radiusFactor;
+    float hpBase;
+    float hpPerSize;
+    float healthCost;
+    int points;
+    int pointsPerLevel;
+    NodeColor color;
+    NodeRenderRoutine renderRoutine;
+    // Collision outline: a regular polygon with corners at size * radiusFactor, the first
+    // one outlinePhase degrees past the node's rotation. 0 sides is a circle.
+    int outlineSides;
+    float outlinePhase;
+    // MovementProfiles::Bit set of the behaviors this shape may spawn with.
+    uint32_t movements;
+    // Whether the shape pushes away from, and is pushed by, other separating nodes.
+    bool separates;
+    // On death, damages nodes within explosionRadius * size for explosionDamage times the
+    // player's damage per tick. 0 radius: no explosion.
+    float explosionRadius;
+    float explosionDamage;
+};
+
+// Indexed by NodeShape; a new enemy type is one enum value plus one row here.
+struct NodeArchetypes {
+    static constexpr int COUNT = 4;
+
+    static constexpr uint32_t CIRCLE_MOVES =
+        MovementProfiles::Bit(MovementBehavior::Linear) | MovementProfiles::Bit(MovementBehavior::SineWave) |
+        MovementProfiles::Bit(MovementBehavior::Spiral) | MovementProfiles::Bit(MovementBehavior::Homing);
+    static constexpr uint32_t SQUARE_MOVES =
+        MovementProfiles::Bit(MovementBehavior::Linear) | MovementProfiles::Bit(MovementBehavior::Accelerate) |
+        MovementProfiles::Bit(MovementBehavior::Decelerate) | MovementProfiles::Bit(MovementBehavior::Homing);
+    static constexpr uint32_t HEXAGON_MOVES =
+        MovementProfiles::Bit(MovementBehavior::Linear) | MovementProfiles::Bit(MovementBehavior::SineWave) |
+        MovementProfiles::Bit(MovementBehavior::Decelerate) | MovementProfiles::Bit(MovementBehavior::Spiral);
+    static constexpr uint32_t BOSS_MOVES = MovementProfiles::Bit(MovementBehavior::Linear);
+
+    static constexpr NodeArchetype TABLE[COUNT] = {
+        // radius  hpBase  hpPerSize  healthCost  points  perLevel  color                render                        sides  phase   movements       separates  blast  blastDamage
+        {1.0f,     0.0f,   2.0f,      0.5f,       100,    0,        {230, 41, 55, 255},  NodeRenderRoutine::Circle,    0,     0.0f,   CIRCLE_MOVES,   true,      0.0f,  0.0f},  // Circle
+        {1.414f,   0.0f,   2.0f,      0.5f,       100,    0,        {230, 41, 55, 255},  NodeRenderRoutine::Square,    4,     45.0f,  SQUARE_MOVES,   true,      0.0f,  0.0f},  // Square
+        {1.0f,     0.0f,   2.0f,      0.5f,       100,    0,        {230, 41, 55, 255},  NodeRenderRoutine::Hexagon,   6,     0.0f,   HEXAGON_MOVES,  true,      3.0f,  1.0f},  // Hexagon
+        {1.414f,   1.0f,   0.0f,      4.0f,       0,      500,      {200, 50, 200, 255}, NodeRenderRoutine::Square,    4,     45.0f,  BOSS_MOVES,     false,     0.0f,  0.0f},  // Boss
+    };
+
+    static constexpr const NodeArchetype& Get(NodeShape shape) {
+        return TABLE[static_cast<int>(shape)];
+    }
+
+    static constexpr float GetMaxHP(NodeShape shape, float size) {
+        return Get(shape).hpBase + Get(shape).hpPerSize * size;
+    }
+
+    static constexpr int GetPoints(NodeShape shape, int level) {
+        return Get(shape).points + Get(shape).pointsPerLevel * level;
+    }
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+enum class DamageZoneShape {
+    Square,
+
+    Circle,
+
+    Ring,
+
+    Rectangle,
+
+    Cone
+};
@@ -2,13 +2,16 @@
 
 enum class EventType {
     NodeSpawned,
+    NodesSpawned,
     NodeDamaged,
     NodeDestroyed,
+    NodesDestroyed,
     PointsChanged,
     MultiplierChanged,
     GameStateChanged,
     GameOver,
     BossSpawned,
     BossDefeated,
+    ProjectilesHit,
     LevelCompleted
 };
@@ -0,0 +1,8 @@
+#pragma once
+
+enum class GameMode {
+    Standard,
+
+    // Spawning keeps ramping with no boss or level end until OVERLOAD_MAX_NODES are alive.
+    Overload
+};
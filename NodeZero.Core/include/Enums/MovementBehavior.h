@@ -0,0 +1,15 @@
+#pragma once
+
+enum class MovementBehavior {
+    Linear,
+
+    SineWave,
+
+    Accelerate,
+
+    Decelerate,
+
+    Spiral,
+
+    Homing
+};
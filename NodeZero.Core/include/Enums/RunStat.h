@@ -0,0 +1,10 @@
+#pragma once
+
+// A column of the run history. Durations are reported in seconds.
+enum class RunStat {
+    LevelReached,
+    Duration,
+    Points,
+    NodesDestroyed,
+    Upgrades
+};
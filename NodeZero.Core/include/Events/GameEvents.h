@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <vector>
 
 #include "Enums/EventType.h"
 #include "Enums/GameScreen.h"
@@ -27,7 +28,11 @@ class GameEvent : public IEvent {
     int nextLevel;
     float bossHP;
 
-    GameEvent(float timestamp, EventType type) : timestamp(timestamp), type(type) {}
+    // Batch events carry one entry per affected node.
+    int count;
+    std::vector<Position> positions;
+
+    GameEvent(float timestamp, EventType type) : timestamp(timestamp), type(type), count(0) {}
 
     float GetTimestamp() const override { return timestamp; }
 
@@ -35,10 +40,14 @@ class GameEvent : public IEvent {
         switch (type) {
             case EventType::NodeSpawned:
                 return "NodeSpawned";
+            case EventType::NodesSpawned:
+                return "NodesSpawned";
             case EventType::NodeDamaged:
                 return "NodeDamaged";
             case EventType::NodeDestroyed:
                 return "NodeDestroyed";
+            case EventType::NodesDestroyed:
+                return "NodesDestroyed";
             case EventType::PointsChanged:
                 return "PointsChanged";
             case EventType::MultiplierChanged:
@@ -51,6 +60,8 @@ class GameEvent : public IEvent {
                 return "BossSpawned";
             case EventType::BossDefeated:
                 return "BossDefeated";
+            case EventType::ProjectilesHit:
+                return "ProjectilesHit";
             case EventType::LevelCompleted:
                 return "LevelCompleted";
             default:
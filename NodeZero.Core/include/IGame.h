@@ -1,19 +1,29 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 
+#include "Enums/GameMode.h"
 #include "Events/ISubject.h"
 #include "Types/PointPickup.h"
 #include "Types/SpawnInfo.h"
+#include "Types/WorldSnapshot.h"
 
 class INode;
+class LevelTable;
 class IUpgradeService;
 class IPickupService;
+class IProjectileService;
+class IRewindService;
 class IHealthService;
 class ILevelService;
 class IDamageZoneService;
 class ISpawnService;
 class ISaveService;
+class IRandomService;
+class IClockService;
+class ICheckpointService;
+class IRunHistoryService;
 
 class IGame : public ISubject {
    public:
@@ -24,24 +34,57 @@ class IGame : public ISubject {
     virtual void Reset() = 0;
     virtual void StartNextLevel() = 0;
 
+    // Takes effect on the next Reset.
+    virtual void SetGameMode(GameMode mode) = 0;
+    virtual GameMode GetGameMode() const = 0;
+
     virtual void SetMousePosition(float x, float y) = 0;
+    virtual Position GetMousePosition() const = 0;
     virtual void SpawnNode(const SpawnInfo& info) = 0;
+    // Spawns every node in one pass and reports them in a single NodesSpawned event.
+    virtual void SpawnNodes(const std::vector<SpawnInfo>& infos) = 0;
 
     virtual float GetScreenWidth() const = 0;
     virtual float GetScreenHeight() const = 0;
 
+    // Copies the world into a caller-owned snapshot, reusing its storage. This is the read
+    // path for drawing, tools and save states.
+    virtual void CaptureSnapshot(WorldSnapshot& snapshot) const = 0;
+    // Includes nodes that are dying but not yet removed.
+    virtual size_t GetNodeCount() const = 0;
+    // For tests and tools that act on individual nodes. Rebuilds the list on every call.
     virtual const std::vector<INode*>& GetNodes() const = 0;
     virtual std::vector<PointPickup> GetCollectedPickupsThisFrame() const = 0;
 
     virtual int GetNodesDestroyed() const = 0;
     virtual void SaveProgress() = 0;
+    // Called once when the run is over, lost or quit: records it in the run history, counts
+    // it in gamesPlayed, saves progress and discards the checkpoint. Later calls do nothing
+    // until the next Reset or resume.
+    virtual void EndRun() = 0;
     virtual int GetHighPoints() const = 0;
 
+    // Replaces the run with the last checkpoint. Scripts start over and projectiles in
+    // flight are not kept. Returns false, leaving the game as it was, without a checkpoint.
+    virtual bool ResumeFromCheckpoint() = 0;
+
+    virtual const LevelTable& GetLevelTable() const = 0;
+
     virtual IUpgradeService& GetUpgradeService() = 0;
     virtual IPickupService& GetPickupService() = 0;
+    virtual IProjectileService& GetProjectileService() = 0;
+    // Records a snapshot after every Update while enabled; Reset and StartNextLevel clear it.
+    virtual IRewindService& GetRewindService() = 0;
     virtual IHealthService& GetHealthService() = 0;
     virtual ILevelService& GetLevelService() = 0;
     virtual IDamageZoneService& GetDamageZoneService() = 0;
     virtual ISpawnService& GetSpawnService() = 0;
     virtual ISaveService& GetSaveService() = 0;
+    virtual IRandomService& GetRandomService() = 0;
+    // How long the last Update took by the injected clock, which a manual clock holds at zero.
+    virtual double GetUpdateMilliseconds() const = 0;
+    virtual IClockService& GetClockService() = 0;
+    // Written every CHECKPOINT_INTERVAL seconds of play; discarded when the run or level ends.
+    virtual ICheckpointService& GetCheckpointService() = 0;
+    virtual IRunHistoryService& GetRunHistoryService() = 0;
 };
@@ -8,8 +8,7 @@ class INode {
    public:
     virtual ~INode() = default;
 
-    virtual Position& GetPosition() = 0;
-    virtual const Position& GetPosition() const = 0;
+    virtual Position GetPosition() const = 0;
     virtual NodeShape GetShape() const = 0;
     virtual NodeState GetState() const = 0;
 
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "Services/ICheckpointService.h"
+#include "Services/IClockService.h"
+#include "Services/IRandomService.h"
+#include "Services/IRunHistoryService.h"
+#include "Services/ISaveService.h"
+#include "Types/SaveData.h"
+
+// Externally provided dependencies of a Game instance. Any member left null is
+// replaced with the default implementation when the Game is constructed.
+struct GameServices {
+    std::unique_ptr<ISaveService> saveService;
+    std::unique_ptr<IRandomService> randomService;
+    std::unique_ptr<IClockService> clockService;
+    std::unique_ptr<ICheckpointService> checkpointService;
+    std::unique_ptr<IRunHistoryService> runHistoryService;
+
+    // File-backed save, checkpoints and run history, wall-clock seeded RNG, steady system clock.
+    static GameServices CreateDefault();
+
+    // No file I/O and fully deterministic: in-memory save, checkpoints and run history, fixed seed, manual clock.
+    static GameServices CreateInMemory(uint64_t seed, const SaveData& initialData = SaveData{});
+};
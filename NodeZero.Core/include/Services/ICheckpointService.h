@@ -0,0 +1,19 @@
+#pragma once
+
+#include "../Types/Checkpoint.h"
+
+// Keeps the latest checkpoint of the run in progress where it outlives the process. Submit
+// is called from the simulation tick and must return without waiting on storage.
+class ICheckpointService {
+   public:
+    virtual ~ICheckpointService() = default;
+
+    // Takes the contents of checkpoint, leaving it with storage to reuse for the next one.
+    // A checkpoint still waiting to be stored is replaced.
+    virtual void Submit(Checkpoint& checkpoint) = 0;
+    // Returns false when there is no checkpoint or it does not read back whole.
+    virtual bool Load(Checkpoint& checkpoint) = 0;
+    virtual bool HasCheckpoint() const = 0;
+    // Called when the run ends, so nothing is offered for resuming.
+    virtual void Discard() = 0;
+};
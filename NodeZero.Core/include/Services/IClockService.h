@@ -0,0 +1,9 @@
+#pragma once
+
+class IClockService {
+   public:
+    virtual ~IClockService() = default;
+
+    // Seconds since the clock was created; only differences are meaningful.
+    virtual double GetTime() const = 0;
+};
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <vector>
 
+#include "Types/DamageZone.h"
+
 class Node;
 
 class IDamageZoneService {
@@ -18,6 +21,14 @@ class IDamageZoneService {
         const std::vector<Node*>& nodes,
         std::function<void(Node*, float)> onNodeDamaged) = 0;
 
+    // Resolves every zone against every node in a single pass over the nodes.
+    // onNodeDamaged receives the node, the scaled health cost and the zone index.
+    virtual void ProcessDamageZones(
+        const std::vector<DamageZone>& zones,
+        int currentLevel,
+        const std::vector<Node*>& nodes,
+        std::function<void(Node*, float, size_t)> onNodeDamaged) = 0;
+
     virtual void UpdateTimer(float deltaTime) = 0;
     virtual void ResetTimer() = 0;
     virtual bool ShouldDealDamage() const = 0;
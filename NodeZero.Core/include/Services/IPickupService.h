@@ -19,4 +19,7 @@ class IPickupService {
 
     virtual void ProcessPickupCollection(float mouseX, float mouseY, float damageZoneSize,
                                          std::vector<PointPickup>& collectedPickups) = 0;
+    // Collects everything the zone passes over while moving from one cursor position to the next.
+    virtual void ProcessPickupCollection(float fromX, float fromY, float toX, float toY, float damageZoneSize,
+                                         std::vector<PointPickup>& collectedPickups) = 0;
 };
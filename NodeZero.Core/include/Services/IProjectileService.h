@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "../Types/Position.h"
+
+class IProjectileService {
+   public:
+    virtual ~IProjectileService() = default;
+
+    // Angles are in degrees. Each returns how many projectiles fit in the pool.
+    virtual int FireRadial(const Position& origin, int count, float speed, float startAngle) = 0;
+    virtual int FireAimed(const Position& origin, const Position& target, int count, float spreadAngle,
+                          float speed) = 0;
+
+    virtual void Update(float deltaTime) = 0;
+    // Removes projectiles touching the square zone and returns how many there were.
+    virtual int ProcessHits(float centerX, float centerY, float zoneSize) = 0;
+    virtual void Clear() = 0;
+
+    virtual size_t GetActiveCount() const = 0;
+    virtual float GetRadius() const = 0;
+
+    // Pool columns for batch rendering: slot i in [0, GetSlotCount()) is live when
+    // GetAlive()[i] is non-zero.
+    virtual size_t GetSlotCount() const = 0;
+    virtual const float* GetXs() const = 0;
+    virtual const float* GetYs() const = 0;
+    virtual const uint8_t* GetAlive() const = 0;
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+class IRandomService {
+   public:
+    virtual ~IRandomService() = default;
+
+    virtual void Seed(uint64_t seed) = 0;
+
+    virtual int NextInt(int maxExclusive) = 0;
+    virtual float NextFloat() = 0;
+    virtual float Range(float minValue, float maxValue) = 0;
+
+    // Raw generator state for checkpoints; SetState continues the same sequence.
+    virtual uint64_t GetState() const = 0;
+    virtual void SetState(uint64_t state) = 0;
+};
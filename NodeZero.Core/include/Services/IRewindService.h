@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Types/WorldSnapshot.h"
+
+// Recent world snapshots for stepping back through a run. Frames are addressed by how far
+// back they are from the newest one; recording always moves the cursor back to the newest.
+class IRewindService {
+   public:
+    virtual ~IRewindService() = default;
+
+    // Recording is off until enabled; disabling also drops what was recorded.
+    virtual void SetEnabled(bool enabled) = 0;
+    virtual bool IsEnabled() const = 0;
+    virtual void Record(const WorldSnapshot& snapshot) = 0;
+    virtual void Clear() = 0;
+
+    virtual size_t GetFrameCount() const = 0;
+    // Encoded bytes held, excluding the decode scratch.
+    virtual size_t GetMemoryUsage() const = 0;
+
+    virtual bool StepBackward() = 0;
+    virtual bool StepForward() = 0;
+    virtual void SeekNewest() = 0;
+    virtual size_t GetFramesBack() const = 0;
+    virtual double GetSecondsBack() const = 0;
+
+    // Rebuilds the frame under the cursor; events are not recorded and come back empty.
+    // Returns false when nothing has been recorded.
+    virtual bool ReadFrame(WorldSnapshot& snapshot) = 0;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../Enums/RunStat.h"
+#include "../Types/RunRecord.h"
+
+// Every finished run, oldest first. Percentiles and averages take the same time however many
+// runs are stored, so the history never has to be read in whole.
+class IRunHistoryService {
+   public:
+    virtual ~IRunHistoryService() = default;
+
+    virtual void Append(const RunRecord& run) = 0;
+    virtual size_t GetRunCount() const = 0;
+    // Index 0 is the oldest run.
+    virtual RunRecord GetRun(size_t index) const = 0;
+
+    // Value at or below which fraction (0 to 1) of the runs fall. Read from a fixed histogram:
+    // exact below 64 (levels, kills and upgrades in practice) and within 1/16 above.
+    virtual double GetPercentile(RunStat stat, float fraction) const = 0;
+    // Mean over runs [first, first + count), clipped to the stored runs; 0 when none are left.
+    virtual double GetAverage(RunStat stat, size_t first, size_t count) const = 0;
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "../Types/SpawnInfo.h"
 
 class ISpawnService {
@@ -10,5 +12,7 @@ class ISpawnService {
     virtual bool ShouldAutoSpawn() const = 0;
 
     virtual SpawnInfo GetNextSpawn() const = 0;
+    // Appends every scheduled spawn that has come due since the last call, in order.
+    virtual void TakeDueSpawns(std::vector<SpawnInfo>& out) = 0;
     virtual float CalculateNodeHP(float baseHP) const = 0;
 };
@@ -13,6 +13,8 @@ class IUpgradeService {
     virtual float GetRegenRate() const = 0;
     virtual float GetDamageZoneSize() const = 0;
     virtual float GetDamagePerTick() const = 0;
+    // Upgrades bought so far, counted back from the current values.
+    virtual int GetUpgradeCount() const = 0;
 
     virtual int GetHealthUpgradeCost() const = 0;
     virtual int GetRegenUpgradeCost() const = 0;
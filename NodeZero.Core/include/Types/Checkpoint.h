@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "PointPickup.h"
+
+// The state of a run in progress, enough to carry on after the process is gone. Every
+// struct here holds only fixed-width fields: the checkpoint file stores them byte for byte.
+
+struct NodeCheckpoint {
+    int32_t id;
+    uint8_t shape;
+    uint8_t movement;
+    float originX;
+    float originY;
+    float size;
+    float speed;
+    float hp;
+    float maxHp;
+    float velocityX;
+    float velocityY;
+    float startRotation;
+    double spawnTime;
+    double startTime;
+};
+
+struct LevelCheckpoint {
+    int32_t level;
+    int32_t nodesDestroyedThisLevel;
+    float levelTimer;
+    float levelDuration;
+    uint8_t bossActive;
+    uint8_t levelCompleted;
+};
+
+struct HealthCheckpoint {
+    float maxHealth;
+    float currentHealth;
+    float regenRate;
+    float healthTimer;
+};
+
+// The schedule segment is rebuilt from its seed and the cursor put back where it was.
+struct SpawnCheckpoint {
+    float spawnTimer;
+    float scheduleTime;
+    float scheduleStart;
+    float scheduleDuration;
+    uint32_t scheduleSeed;
+    uint32_t scheduleCursor;
+    // Overload room the segment was built with
+    uint32_t scheduleRoom;
+    uint8_t scheduleValid;
+};
+
+struct DamageZoneCheckpoint {
+    float damageTimer;
+};
+
+struct PickupCheckpoint {
+    int32_t nextPickupId;
+    int32_t pickupPoints;
+};
+
+struct WorldCheckpoint {
+    double simTime;
+    uint64_t randomState;
+    float elapsedTime;
+    int32_t mode;
+    int32_t nodesDestroyed;
+    // Points of the levels already finished this run
+    int32_t runPoints;
+    int32_t nextNodeId;
+    // -1 when no boss is alive
+    int32_t bossId;
+    float mouseX;
+    float mouseY;
+    LevelCheckpoint level;
+    HealthCheckpoint health;
+    SpawnCheckpoint spawn;
+    DamageZoneCheckpoint damageZone;
+    PickupCheckpoint pickups;
+};
+
+struct Checkpoint {
+    WorldCheckpoint world;
+    std::vector<NodeCheckpoint> nodes;
+    std::vector<PointPickup> pickups;
+};
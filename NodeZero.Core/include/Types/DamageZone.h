@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Enums/DamageZoneShape.h"
+
+// A region that damages the nodes it touches. size is the square's side, the circle's and
+// ring's outer diameter, the rectangle's length along its rotation and the cone's reach.
+struct DamageZone {
+    float centerX;
+    float centerY;
+    float size;
+    float damage;
+    // Multiplies the node's health cost; 0 for zones that should not drain the player.
+    float healthCostScale = 1.0f;
+    // Zones sharing a group (0-31) hit a node at most once per pass, the first zone in
+    // the list wins. -1 lets the zone stack with every other zone.
+    int group = -1;
+    DamageZoneShape shape = DamageZoneShape::Square;
+    // Degrees, same convention as node rotation. The cone points along it.
+    float rotation = 0.0f;
+    // Ring hole diameter, or rectangle extent across the rotation.
+    float innerSize = 0.0f;
+    // Full opening angle of a cone in degrees.
+    float spreadAngle = 90.0f;
+};
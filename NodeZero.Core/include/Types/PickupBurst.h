@@ -0,0 +1,10 @@
+#pragma once
+
+#include "Position.h"
+
+// A ring of pickups scattered around one origin.
+struct PickupBurst {
+    Position origin;
+    int count;
+    int pointValue;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+// One finished run as kept in the run history.
+struct RunRecord {
+    uint32_t levelReached = 0;
+    uint32_t durationMilliseconds = 0;
+    uint32_t points = 0;
+    uint32_t nodesDestroyed = 0;
+    // Upgrades owned when the run ended
+    uint32_t upgrades = 0;
+};
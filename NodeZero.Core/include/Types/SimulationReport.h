@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+struct UpgradeConfig {
+    int healthUpgrades = 0;
+    int regenUpgrades = 0;
+    int damageZoneUpgrades = 0;
+    int damageUpgrades = 0;
+};
+
+struct SimulationRunResult {
+    float survivalTime = 0.0f;
+    int points = 0;
+    int nodesDestroyed = 0;
+    int levelReached = 1;
+    bool survived = false;
+
+    float GetPointsPerMinute() const {
+        if (survivalTime <= 0.0f) {
+            return 0.0f;
+        }
+        return points * 60.0f / survivalTime;
+    }
+};
+
+// One window of an overload run: how many nodes were alive and what a tick cost.
+struct OverloadSample {
+    float simTime = 0.0f;
+    size_t liveNodes = 0;
+    double tickMilliseconds = 0.0;
+    double nanosecondsPerNode = 0.0;
+};
+
+struct Histogram {
+    float minValue = 0.0f;
+    float maxValue = 0.0f;
+    std::vector<int> buckets;
+    int sampleCount = 0;
+    float mean = 0.0f;
+    float median = 0.0f;
+    float p90 = 0.0f;
+
+    static Histogram Build(std::vector<float> samples, int bucketCount) {
+        Histogram histogram;
+        histogram.buckets.assign(std::max(bucketCount, 1), 0);
+        histogram.sampleCount = static_cast<int>(samples.size());
+        if (samples.empty()) {
+            return histogram;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        histogram.minValue = samples.front();
+        histogram.maxValue = samples.back();
+        histogram.median = samples[samples.size() / 2];
+        histogram.p90 = samples[std::min(samples.size() - 1, samples.size() * 9 / 10)];
+
+        float sum = 0.0f;
+        float range = histogram.maxValue - histogram.minValue;
+        int bucketTotal = static_cast<int>(histogram.buckets.size());
+        int lastBucket = bucketTotal - 1;
+        for (float sample : samples) {
+            sum += sample;
+            // Equal-width bins over [min, max]; the maximum itself falls in the last one
+            int bucket = range > 0.0f ? static_cast<int>((sample - histogram.minValue) / range * bucketTotal) : 0;
+            histogram.buckets[std::clamp(bucket, 0, lastBucket)]++;
+        }
+        histogram.mean = sum / histogram.sampleCount;
+
+        return histogram;
+    }
+};
+
+// Aggregated outcome of every run that shared one start level and upgrade configuration.
+struct SweepCellReport {
+    int startLevel = 1;
+    UpgradeConfig upgrades;
+    std::vector<SimulationRunResult> runs;
+    Histogram survivalTime;
+    Histogram pointsPerMinute;
+    Histogram nodesDestroyed;
+};
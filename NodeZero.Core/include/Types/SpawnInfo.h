@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Position.h"
+#include "../Enums/MovementBehavior.h"
 #include "../Enums/NodeShape.h"
 
 struct SpawnInfo {
@@ -8,4 +9,5 @@ struct SpawnInfo {
     NodeShape shape;
     float directionX;
     float directionY;
+    MovementBehavior movement = MovementBehavior::Linear;
 };
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Enums/EventType.h"
+#include "Enums/GameMode.h"
+#include "Enums/NodeShape.h"
+#include "Position.h"
+
+struct NodeSnapshot {
+    int id;
+    float x;
+    float y;
+    float size;
+    float hp;
+    float maxHp;
+    float rotation;
+    NodeShape shape;
+};
+
+struct PickupSnapshot {
+    Position position;
+    Position spawnOrigin;
+    float size;
+    float age;
+    float lifeRatio;
+    int points;
+};
+
+struct SnapshotEvent {
+    EventType type;
+    Position position;
+};
+
+// Everything a frame needs to draw the world, copied out of the game so it can be read
+// on another thread. The vectors are reused between captures and only ever grow.
+// IGame::CaptureSnapshot fills all of it except tick, tickMilliseconds and events, which
+// belong to whoever steps the game and publishes the snapshot.
+struct WorldSnapshot {
+    uint64_t tick = 0;
+    double tickMilliseconds = 0.0;
+    double simTime = 0.0;
+
+    // Active nodes only
+    std::vector<NodeSnapshot> nodes;
+    std::vector<PickupSnapshot> pickups;
+    // Collected during the last update
+    std::vector<PickupSnapshot> collectedPickups;
+    std::vector<float> projectileXs;
+    std::vector<float> projectileYs;
+    float projectileRadius = 0.0f;
+    // Events raised since the previous snapshot the reader saw
+    std::vector<SnapshotEvent> events;
+
+    Position zoneCenter{0.0f, 0.0f};
+    float damageZoneSize = 0.0f;
+    float health = 0.0f;
+    float maxHealth = 0.0f;
+    int pickupPoints = 0;
+    int level = 1;
+    float levelProgress = 0.0f;
+    GameMode mode = GameMode::Standard;
+    bool healthDepleted = false;
+    bool levelCompleted = false;
+};
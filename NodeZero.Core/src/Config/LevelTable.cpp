@@ -0,0 +1,76 @@
+#include "Config/LevelTable.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "Config/GameConfig.h"
+
+LevelTable::LevelTable() {
+    m_Levels.reserve(GameConfig::LEVEL_TABLE_SIZE);
+    for (int level = 1; level <= GameConfig::LEVEL_TABLE_SIZE; ++level) {
+        m_Levels.push_back(ComputeDefault(level));
+    }
+}
+
+const LevelParams& LevelTable::Get(int level) const {
+    int index = std::max(1, std::min(level, static_cast<int>(m_Levels.size()))) - 1;
+    return m_Levels[index];
+}
+
+int LevelTable::GetLevelCount() const {
+    return static_cast<int>(m_Levels.size());
+}
+
+void LevelTable::Set(int level, const LevelParams& params) {
+    if (level < 1) {
+        return;
+    }
+
+    while (static_cast<int>(m_Levels.size()) < level) {
+        m_Levels.push_back(ComputeDefault(static_cast<int>(m_Levels.size()) + 1));
+    }
+    m_Levels[level - 1] = params;
+}
+
+bool LevelTable::LoadFromFile(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream stream(line);
+        int level = 0;
+        LevelParams params{};
+        if (stream >> level >> params.spawnInterval >> params.nodeHPScale >> params.healthDepletionScale >>
+            params.healthCostScale >> params.bossHP) {
+            Set(level, params);
+        }
+    }
+
+    return true;
+}
+
+LevelParams LevelTable::ComputeDefault(int level) {
+    float steps = static_cast<float>(level - 1);
+
+    LevelParams params{};
+    params.spawnInterval = std::max(GameConfig::SPAWN_INTERVAL_MIN,
+                                    GameConfig::SPAWN_INTERVAL_BASE - steps * GameConfig::SPAWN_INTERVAL_STEP);
+    params.nodeHPScale = 1.0f + steps * GameConfig::NODE_HP_SCALE_PER_LEVEL;
+    params.healthDepletionScale = 1.0f + steps * GameConfig::HEALTH_DEPLETION_SCALE_PER_LEVEL;
+    params.healthCostScale = 1.0f + steps * GameConfig::HEALTH_COST_SCALE_PER_LEVEL;
+    params.bossHP = GameConfig::BOSS_HP_BASE + steps * GameConfig::BOSS_HP_PER_LEVEL;
+    return params;
+}
+
+const LevelTable& LevelTable::Default() {
+    static const LevelTable table;
+    return table;
+}
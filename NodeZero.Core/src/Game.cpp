@@ -2,37 +2,84 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
-#include <ctime>
+#include <limits>
 
 #include "Config/GameConfig.h"
+#include "Config/MovementProfiles.h"
+#include "Config/NodeArchetypes.h"
 #include "Events/GameEvents.h"
+#include "Math/FastMath.h"
+#include "Scripting/BehaviorScripts.h"
+#include "Services/CheckpointService.h"
+#include "Services/ClockService.h"
+#include "Services/RandomService.h"
+#include "Services/RunHistoryService.h"
+#include "Services/SaveService.h"
 
 Game::Game()
+    : Game(GameServices::CreateDefault()) {
+}
+
+Game::Game(GameServices services)
     : m_ScreenWidth(0.0f),
       m_ScreenHeight(0.0f),
       m_ElapsedTime(0.0f),
+      m_SimTime(0.0),
+      m_UpdateMilliseconds(0.0),
       m_NodesDestroyed(0),
+      m_RunPoints(0),
+      m_RunEnded(false),
       m_HighPoints(0),
       m_Boss(nullptr),
       m_MouseX(0.0f),
-      m_MouseY(0.0f) {
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+      m_MouseY(0.0f),
+      m_PreviousMouseX(0.0f),
+      m_PreviousMouseY(0.0f),
+      m_HasPreviousMouse(false),
+      m_NextNodeId(0),
+      m_ThreadPool(nullptr),
+      m_GameMode(GameMode::Standard),
+      m_AppliedLevel(0),
+      m_SaveService(std::move(services.saveService)),
+      m_RandomService(std::move(services.randomService)),
+      m_ClockService(std::move(services.clockService)),
+      m_CheckpointService(std::move(services.checkpointService)),
+      m_RunHistoryService(std::move(services.runHistoryService)),
+      m_NextCheckpointTime(0.0),
+      m_HasCheckpoint(false) {
+    if (!m_SaveService) {
+        m_SaveService = std::make_unique<SaveService>();
+    }
+    if (!m_ClockService) {
+        m_ClockService = std::make_unique<ClockService>();
+    }
+    if (!m_RandomService) {
+        m_RandomService = std::make_unique<RandomService>();
+    }
+    if (!m_CheckpointService) {
+        m_CheckpointService = std::make_unique<CheckpointService>();
+    }
+    if (!m_RunHistoryService) {
+        m_RunHistoryService = std::make_unique<RunHistoryService>();
+    }
 
-    SaveData saveData = m_SaveService.LoadProgress();
+    SaveData saveData = m_SaveService->LoadProgress();
     m_HighPoints = saveData.highPoints;
 
-    m_UpgradeService.SetSaveService(&m_SaveService);
+    m_UpgradeService.SetSaveService(m_SaveService.get());
+    m_SpawnService.SetRandomService(m_RandomService.get());
+    m_PickupService.SetRandomService(m_RandomService.get());
+    m_SpawnService.SetLevelTable(&m_LevelTable);
+    m_HealthService.SetLevelTable(&m_LevelTable);
+    m_DamageZoneService.SetLevelTable(&m_LevelTable);
     m_UpgradeService.Initialize(saveData.maxHealth, saveData.regenRate, saveData.damageZoneSize, saveData.damagePerTick);
     m_HealthService.Initialize(saveData.maxHealth, saveData.regenRate);
     m_LevelService.Initialize(saveData.currentLevel);
+    ApplyLevelParams();
 }
 
 Game::~Game() {
-    for (Node* node : m_Nodes) {
-        delete node;
-    }
-    m_Nodes.clear();
+    ClearNodes();
 }
 
 void Game::Initialize(float screenWidth, float screenHeight) {
@@ -40,24 +87,29 @@ void Game::Initialize(float screenWidth, float screenHeight) {
     m_ScreenHeight = screenHeight;
 
     m_PickupService.Initialize(screenHeight);
+    m_ProjectileService.Initialize(screenWidth, screenHeight);
     m_SpawnService.Initialize(screenWidth, screenHeight);
-    m_SpawnService.SetCurrentLevel(m_LevelService.GetCurrentLevel());
+    ApplyLevelParams();
 }
 
 void Game::Update(float deltaTime) {
+    double updateStart = m_ClockService->GetTime();
     m_CollectedPickupsThisFrame.clear();
 
-    m_HealthService.Update(deltaTime);
-    m_HealthService.SetCurrentLevel(m_LevelService.GetCurrentLevel());
+    if (m_LevelService.GetCurrentLevel() != m_AppliedLevel) {
+        ApplyLevelParams();
+    }
 
+    m_HealthService.Update(deltaTime);
     m_SpawnService.UpdateAutoSpawn(deltaTime);
-    m_SpawnService.SetCurrentLevel(m_LevelService.GetCurrentLevel());
 
-    if (m_SpawnService.ShouldAutoSpawn()) {
-        SpawnInfo info = m_SpawnService.GetNextSpawn();
-        SpawnNode(info);
-        m_SpawnService.ResetSpawnTimer();
+    if (m_GameMode == GameMode::Overload) {
+        size_t maxNodes = GameConfig::OVERLOAD_MAX_NODES;
+        m_SpawnService.SetOverloadRoom(maxNodes - std::min(m_Nodes.size(), maxNodes));
     }
+    m_SpawnBatch.clear();
+    m_SpawnService.TakeDueSpawns(m_SpawnBatch);
+    SpawnNodes(m_SpawnBatch);
 
     m_DamageZoneService.UpdateTimer(deltaTime);
 
@@ -65,86 +117,79 @@ void Game::Update(float deltaTime) {
     if (shouldDealDamage) {
         m_DamageZoneService.ResetTimer();
 
-        auto onNodeDamaged = [this](Node* node, float healthCost) {
+        m_DamageZones.assign(1, DamageZone{m_MouseX, m_MouseY, m_UpgradeService.GetDamageZoneSize(),
+                                           m_UpgradeService.GetDamagePerTick()});
+
+        auto onNodeDamaged = [this](Node* node, float healthCost, size_t zoneIndex) {
             Position nodePos = node->GetPosition();
             auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodeDamaged);
             event->position = nodePos;
-            event->damage = static_cast<int>(m_UpgradeService.GetDamagePerTick());
+            event->damage = static_cast<int>(m_DamageZones[zoneIndex].damage);
             event->hp = static_cast<int>(node->GetHP());
             Notify(event);
 
             m_HealthService.Reduce(healthCost);
         };
 
-        m_DamageZoneService.ProcessDamageZone(
-            m_MouseX,
-            m_MouseY,
-            m_UpgradeService.GetDamageZoneSize(),
-            m_UpgradeService.GetDamagePerTick(),
+        m_DamageZoneService.ProcessDamageZones(
+            m_DamageZones,
             m_LevelService.GetCurrentLevel(),
             m_Nodes,
             onNodeDamaged);
     }
 
-    m_CollectedPickupsThisFrame = m_PickupService.ProcessPickupCollection(m_MouseX, m_MouseY, m_UpgradeService.GetDamageZoneSize());
+    if (!m_HasPreviousMouse) {
+        m_PreviousMouseX = m_MouseX;
+        m_PreviousMouseY = m_MouseY;
+        m_HasPreviousMouse = true;
+    }
+
+    m_PickupService.ProcessPickupCollection(m_PreviousMouseX, m_PreviousMouseY, m_MouseX, m_MouseY,
+                                            m_UpgradeService.GetDamageZoneSize(), m_CollectedPickupsThisFrame);
+    m_PreviousMouseX = m_MouseX;
+    m_PreviousMouseY = m_MouseY;
+
+    m_ScriptScheduler.Update(m_SimTime, *this);
+    m_ProjectileService.Update(deltaTime);
+
+    int projectileHits = m_ProjectileService.ProcessHits(m_MouseX, m_MouseY, m_UpgradeService.GetDamageZoneSize());
+    if (projectileHits > 0) {
+        m_HealthService.Reduce(projectileHits * GameConfig::PROJECTILE_HEALTH_COST);
+
+        auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::ProjectilesHit);
+        event->position = Position{m_MouseX, m_MouseY};
+        event->count = projectileHits;
+        Notify(event);
+    }
+
+    SteerNodes(deltaTime);
+    SeparateNodes(deltaTime);
 
     m_ElapsedTime += deltaTime;
+    m_SimTime += deltaTime;
+    RetireExitedNodes();
 
-    m_LevelService.Update(deltaTime, m_LevelService.IsBossActive());
+    // Overload has no level clock and no boss; it only ends when health runs out
+    if (m_GameMode == GameMode::Standard) {
+        m_LevelService.Update(deltaTime, m_LevelService.IsBossActive());
+    }
 
-    for (Node* node : m_Nodes) {
-        node->Update(deltaTime);
-    }
-
-    m_Nodes.erase(
-        std::remove_if(m_Nodes.begin(), m_Nodes.end(),
-                       [this](Node* node) {
-                           bool isBoss = node->GetShape() == NodeShape::Boss;
-                           bool isOffScreen = node->GetPosition().x < -200.0f;
-
-                           if (isBoss) {
-                               isOffScreen = false;
-                           }
-
-                           bool shouldRemove = node->GetState() == NodeState::Dead || isOffScreen;
-
-                           if (shouldRemove) {
-                               if (node->GetState() == NodeState::Dead) {
-                                   Position position{node->GetPosition().x, node->GetPosition().y};
-
-                                   if (isBoss) {
-                                       int pointsGained = 500 * m_LevelService.GetCurrentLevel();
-                                       auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::BossDefeated);
-                                       event->level = m_LevelService.GetCurrentLevel();
-                                       event->points = pointsGained;
-                                       Notify(event);
-
-                                       m_LevelService.SetBossActive(false);
-                                       m_Boss = nullptr;
-                                       m_LevelService.SetLevelCompleted(true);
-                                   } else {
-                                       auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodeDestroyed);
-                                       event->shape = node->GetShape();
-                                       event->position = position;
-                                       event->points = 100;
-                                       Notify(event);
-                                       m_PickupService.SpawnPointPickups(position);
-                                       m_NodesDestroyed++;
-                                       m_LevelService.IncrementNodesDestroyed();
-                                   }
-                               }
-
-                               delete node;
-                           }
-                           return shouldRemove;
-                       }),
-        m_Nodes.end());
-
-    if (m_LevelService.ShouldSpawnBoss()) {
+    ProcessDeaths();
+
+    if (m_GameMode == GameMode::Standard && m_LevelService.ShouldSpawnBoss()) {
         SpawnBoss();
     }
 
     m_PickupService.Update(deltaTime);
+
+    if (m_RewindService.IsEnabled()) {
+        CaptureSnapshot(m_RewindSnapshot);
+        m_RewindService.Record(m_RewindSnapshot);
+    }
+
+    UpdateCheckpoint();
+
+    m_UpdateMilliseconds = (m_ClockService->GetTime() - updateStart) * 1000.0;
 }
 
 float Game::GetScreenWidth() const {
@@ -155,11 +200,99 @@ float Game::GetScreenHeight() const {
     return m_ScreenHeight;
 }
 
+void Game::CaptureSnapshot(WorldSnapshot& snapshot) const {
+    snapshot.simTime = m_SimTime;
+
+    // Node is final, so these calls bind statically
+    snapshot.nodes.clear();
+    for (const Node* node : m_Nodes) {
+        if (node->GetState() != NodeState::Active) {
+            continue;
+        }
+        Position position = node->GetPositionAt(m_SimTime);
+        snapshot.nodes.push_back(NodeSnapshot{node->GetId(), position.x, position.y, node->GetSize(), node->GetHP(),
+                                              node->GetMaxHP(), node->GetRotationAt(m_SimTime), node->GetShape()});
+    }
+
+    auto toSnapshot = [](const PointPickup& pickup) {
+        return PickupSnapshot{pickup.position, pickup.spawnOrigin, pickup.size, pickup.GetAge(), pickup.GetLifeRatio(),
+                              pickup.points};
+    };
+    snapshot.pickups.clear();
+    for (const PointPickup& pickup : m_PickupService.GetPickups()) {
+        snapshot.pickups.push_back(toSnapshot(pickup));
+    }
+    snapshot.collectedPickups.clear();
+    for (const PointPickup& pickup : m_CollectedPickupsThisFrame) {
+        snapshot.collectedPickups.push_back(toSnapshot(pickup));
+    }
+
+    snapshot.projectileXs.clear();
+    snapshot.projectileYs.clear();
+    const float* xs = m_ProjectileService.GetXs();
+    const float* ys = m_ProjectileService.GetYs();
+    const uint8_t* alive = m_ProjectileService.GetAlive();
+    for (size_t i = 0; i < m_ProjectileService.GetSlotCount(); ++i) {
+        if (alive[i]) {
+            snapshot.projectileXs.push_back(xs[i]);
+            snapshot.projectileYs.push_back(ys[i]);
+        }
+    }
+    snapshot.projectileRadius = m_ProjectileService.GetRadius();
+
+    snapshot.zoneCenter = Position{m_MouseX, m_MouseY};
+    snapshot.damageZoneSize = m_UpgradeService.GetDamageZoneSize();
+    snapshot.health = m_HealthService.GetCurrent();
+    snapshot.maxHealth = m_UpgradeService.GetMaxHealth();
+    snapshot.pickupPoints = m_PickupService.GetPickupPoints();
+    snapshot.level = m_LevelService.GetCurrentLevel();
+    snapshot.levelProgress = m_LevelService.GetProgressBarPercentage();
+    snapshot.mode = m_GameMode;
+    snapshot.healthDepleted = m_HealthService.IsZero();
+    snapshot.levelCompleted = m_LevelService.IsLevelCompleted();
+}
+
+size_t Game::GetNodeCount() const {
+    return m_Nodes.size();
+}
+
 const std::vector<INode*>& Game::GetNodes() const {
-    return reinterpret_cast<const std::vector<INode*>&>(m_Nodes);
+    m_NodeViews.assign(m_Nodes.begin(), m_Nodes.end());
+    return m_NodeViews;
 }
 
 void Game::SpawnNode(const SpawnInfo& info) {
+    Node* node = AddSpawnedNode(info);
+
+    auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodeSpawned);
+    event->shape = node->GetShape();
+    event->position = info.position;
+    event->size = node->GetSize();
+    event->hp = static_cast<int>(node->GetHP());
+    Notify(event);
+}
+
+void Game::SpawnNodes(const std::vector<SpawnInfo>& infos) {
+    if (infos.empty()) {
+        return;
+    }
+
+    m_Nodes.reserve(m_Nodes.size() + infos.size());
+    m_NodesById.reserve(m_NodesById.size() + infos.size());
+
+    auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodesSpawned);
+    event->count = static_cast<int>(infos.size());
+    event->positions.reserve(infos.size());
+
+    for (const SpawnInfo& info : infos) {
+        AddSpawnedNode(info);
+        event->positions.push_back(info.position);
+    }
+
+    Notify(event);
+}
+
+Node* Game::AddSpawnedNode(const SpawnInfo& info) {
     float nodeSize = m_ScreenHeight * 0.0375f;
     Node* node = CreateNode(info.shape, nodeSize, GameConfig::NODE_DEFAULT_SPEED);
 
@@ -168,41 +301,167 @@ void Game::SpawnNode(const SpawnInfo& info) {
     node->SetHP(scaledHP);
 
     node->Spawn(info.position.x, info.position.y);
+    node->SetMovement(info.movement);
     node->SetDirection(info.directionX, info.directionY);
     m_Nodes.push_back(node);
+    ScheduleExit(node);
 
-    auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodeSpawned);
-    event->shape = node->GetShape();
-    event->position = info.position;
-    event->size = node->GetSize();
-    event->hp = static_cast<int>(node->GetHP());
-    Notify(event);
+    if (MovementProfiles::Get(info.movement).turnRate > 0.0f) {
+        m_SteeredNodes.push_back(node);
+    }
+
+    return node;
 }
 
 void Game::Reset() {
-    for (Node* node : m_Nodes) {
-        delete node;
-    }
-    m_Nodes.clear();
+    ClearNodes();
+    m_HasPreviousMouse = false;
 
     m_ElapsedTime = 0.0f;
+    m_SimTime = 0.0;
 
     m_PickupService.Reset();
+    m_ProjectileService.Clear();
+    m_RewindService.Clear();
     m_HealthService.Reset(m_UpgradeService.GetMaxHealth());
 
     m_NodesDestroyed = 0;
+    m_RunPoints = 0;
+    m_RunEnded = false;
 
+    m_SpawnService.SetOverload(m_GameMode == GameMode::Overload);
     m_SpawnService.ResetSpawnTimer();
     m_DamageZoneService.ResetTimer();
 
-    SaveData saveData = m_SaveService.LoadProgress();
+    SaveData saveData = m_SaveService->LoadProgress();
     m_LevelService.Reset(saveData.currentLevel);
+    ApplyLevelParams();
 
     m_Boss = nullptr;
+    StartLevelScripts();
+
+    // The new run is checkpointed on its first update
+    m_NextCheckpointTime = m_SimTime;
 }
 
 Node* Game::CreateNode(NodeShape shape, float size, float speed) {
-    return new Node(shape, size, speed);
+    Node* node = new Node(shape, size, speed);
+    node->SetClock(&m_SimTime);
+    node->SetId(m_NextNodeId++);
+    return node;
+}
+
+void Game::UpdateCheckpoint() {
+    // A finished run or level has nothing left to resume
+    if (m_HealthService.IsZero() || m_LevelService.IsLevelCompleted()) {
+        if (m_HasCheckpoint) {
+            m_CheckpointService->Discard();
+            m_HasCheckpoint = false;
+        }
+        return;
+    }
+
+    if (m_SimTime < m_NextCheckpointTime) {
+        return;
+    }
+    CaptureCheckpoint(m_Checkpoint);
+    m_CheckpointService->Submit(m_Checkpoint);
+    m_HasCheckpoint = true;
+    m_NextCheckpointTime = m_SimTime + GameConfig::CHECKPOINT_INTERVAL;
+}
+
+void Game::CaptureCheckpoint(Checkpoint& checkpoint) const {
+    WorldCheckpoint& world = checkpoint.world;
+    world = WorldCheckpoint{};
+    world.simTime = m_SimTime;
+    world.randomState = m_RandomService->GetState();
+    world.elapsedTime = m_ElapsedTime;
+    world.mode = static_cast<int32_t>(m_GameMode);
+    world.nodesDestroyed = m_NodesDestroyed;
+    world.runPoints = m_RunPoints;
+    world.nextNodeId = m_NextNodeId;
+    world.bossId = m_Boss && m_Boss->GetState() == NodeState::Active ? m_Boss->GetId() : -1;
+    world.mouseX = m_MouseX;
+    world.mouseY = m_MouseY;
+    m_LevelService.SaveCheckpoint(world.level);
+    m_HealthService.SaveCheckpoint(world.health);
+    m_SpawnService.SaveCheckpoint(world.spawn);
+    m_DamageZoneService.SaveCheckpoint(world.damageZone);
+    m_PickupService.SaveCheckpoint(world.pickups, checkpoint.pickups);
+
+    checkpoint.nodes.clear();
+    for (const Node* node : m_Nodes) {
+        if (node->GetState() == NodeState::Active) {
+            checkpoint.nodes.emplace_back();
+            node->SaveCheckpoint(checkpoint.nodes.back());
+        }
+    }
+}
+
+bool Game::ResumeFromCheckpoint() {
+    if (!m_CheckpointService->Load(m_Checkpoint)) {
+        return false;
+    }
+    const WorldCheckpoint& world = m_Checkpoint.world;
+
+    ClearNodes();
+    m_HasPreviousMouse = false;
+    m_CollectedPickupsThisFrame.clear();
+    m_ProjectileService.Clear();
+    m_RewindService.Clear();
+
+    m_GameMode = static_cast<GameMode>(world.mode);
+    m_SimTime = world.simTime;
+    m_ElapsedTime = world.elapsedTime;
+    m_NodesDestroyed = world.nodesDestroyed;
+    m_RunPoints = world.runPoints;
+    m_RunEnded = false;
+    m_MouseX = world.mouseX;
+    m_MouseY = world.mouseY;
+    m_RandomService->SetState(world.randomState);
+
+    // The level comes first: the spawn schedule is rebuilt for it
+    m_LevelService.LoadCheckpoint(world.level);
+    ApplyLevelParams();
+    m_HealthService.LoadCheckpoint(world.health);
+    m_DamageZoneService.LoadCheckpoint(world.damageZone);
+    m_SpawnService.SetOverload(m_GameMode == GameMode::Overload);
+    m_SpawnService.LoadCheckpoint(world.spawn);
+    m_PickupService.LoadCheckpoint(world.pickups, m_Checkpoint.pickups);
+
+    m_Boss = nullptr;
+    m_Nodes.reserve(m_Checkpoint.nodes.size());
+    for (const NodeCheckpoint& record : m_Checkpoint.nodes) {
+        Node* node = new Node(static_cast<NodeShape>(record.shape), record.size, record.speed);
+        node->SetClock(&m_SimTime);
+        node->LoadCheckpoint(record);
+        m_Nodes.push_back(node);
+        ScheduleExit(node);
+        if (MovementProfiles::Get(node->GetMovement()).turnRate > 0.0f) {
+            m_SteeredNodes.push_back(node);
+        }
+        if (record.id == world.bossId) {
+            m_Boss = node;
+        }
+    }
+    m_NextNodeId = world.nextNodeId;
+
+    StartLevelScripts();
+    if (m_Boss) {
+        m_ScriptScheduler.Start(BehaviorScripts::Boss(), m_Boss->GetId(), m_SimTime);
+    }
+
+    m_HasCheckpoint = true;
+    m_NextCheckpointTime = m_SimTime + GameConfig::CHECKPOINT_INTERVAL;
+    return true;
+}
+
+double Game::GetSimTime() const {
+    return m_SimTime;
+}
+
+void Game::SetThreadPool(ThreadPool* threadPool) {
+    m_ThreadPool = threadPool;
 }
 
 int Game::GetNodesDestroyed() const {
@@ -210,10 +469,37 @@ int Game::GetNodesDestroyed() const {
 }
 
 void Game::SaveProgress() {
-    SaveData saveData = m_SaveService.LoadProgress();
+    StoreProgress(false);
+}
+
+void Game::EndRun() {
+    if (m_RunEnded) {
+        return;
+    }
+    m_RunEnded = true;
+
+    RunRecord run;
+    run.levelReached = static_cast<uint32_t>(m_LevelService.GetCurrentLevel());
+    run.durationMilliseconds = static_cast<uint32_t>(std::lround(std::max(0.0f, m_ElapsedTime) * 1000.0f));
+    run.points = static_cast<uint32_t>(std::max(0, m_RunPoints + m_PickupService.GetPickupPoints()));
+    run.nodesDestroyed = static_cast<uint32_t>(std::max(0, m_NodesDestroyed));
+    run.upgrades = static_cast<uint32_t>(m_UpgradeService.GetUpgradeCount());
+    m_RunHistoryService->Append(run);
+
+    StoreProgress(true);
+
+    m_CheckpointService->Discard();
+    m_HasCheckpoint = false;
+}
+
+void Game::StoreProgress(bool runEnded) {
+    SaveData saveData = m_SaveService->LoadProgress();
 
     saveData.totalNodesDestroyed += m_NodesDestroyed;
     saveData.points += m_PickupService.GetPickupPoints();
+    if (runEnded) {
+        saveData.gamesPlayed++;
+    }
 
     if (m_PickupService.GetPickupPoints() > saveData.highPoints) {
         saveData.highPoints = m_PickupService.GetPickupPoints();
@@ -226,7 +512,7 @@ void Game::SaveProgress() {
     saveData.damageZoneSize = m_UpgradeService.GetDamageZoneSize();
     saveData.damagePerTick = m_UpgradeService.GetDamagePerTick();
 
-    m_SaveService.SaveProgress(saveData);
+    m_SaveService->SaveProgress(saveData);
 }
 
 int Game::GetHighPoints() const {
@@ -241,6 +527,14 @@ IPickupService& Game::GetPickupService() {
     return m_PickupService;
 }
 
+IProjectileService& Game::GetProjectileService() {
+    return m_ProjectileService;
+}
+
+IRewindService& Game::GetRewindService() {
+    return m_RewindService;
+}
+
 IHealthService& Game::GetHealthService() {
     return m_HealthService;
 }
@@ -258,7 +552,27 @@ ISpawnService& Game::GetSpawnService() {
 }
 
 ISaveService& Game::GetSaveService() {
-    return m_SaveService;
+    return *m_SaveService;
+}
+
+IRandomService& Game::GetRandomService() {
+    return *m_RandomService;
+}
+
+ICheckpointService& Game::GetCheckpointService() {
+    return *m_CheckpointService;
+}
+
+IRunHistoryService& Game::GetRunHistoryService() {
+    return *m_RunHistoryService;
+}
+
+double Game::GetUpdateMilliseconds() const {
+    return m_UpdateMilliseconds;
+}
+
+IClockService& Game::GetClockService() {
+    return *m_ClockService;
 }
 
 void Game::Attach(std::shared_ptr<IObserver> observer) {
@@ -273,35 +587,385 @@ void Game::Notify(const std::shared_ptr<IEvent>& event) {
     m_Subject.Notify(event);
 }
 
+void Game::ProcessDeaths() {
+    ResolveExplosions();
+
+    // Compact the live nodes and set aside the dead and retired ones.
+    size_t writeIndex = 0;
+    for (Node* node : m_Nodes) {
+        if (node->GetState() != NodeState::Active) {
+            m_RetiredNodes.push_back(node);
+        } else {
+            m_Nodes[writeIndex++] = node;
+        }
+    }
+    m_Nodes.resize(writeIndex);
+
+    if (m_RetiredNodes.empty()) {
+        return;
+    }
+
+    m_SteeredNodes.erase(std::remove_if(m_SteeredNodes.begin(), m_SteeredNodes.end(),
+                                        [](const Node* node) { return node->GetState() != NodeState::Active; }),
+                         m_SteeredNodes.end());
+
+    int level = m_LevelService.GetCurrentLevel();
+    int pointsGained = 0;
+    m_RewardOrigins.clear();
+
+    for (Node* node : m_RetiredNodes) {
+        if (node->GetState() != NodeState::Dead) {
+            continue;
+        }
+
+        Position position = node->GetPosition();
+
+        if (node->GetShape() == NodeShape::Boss) {
+            auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::BossDefeated);
+            event->level = level;
+            event->points = NodeArchetypes::GetPoints(node->GetShape(), level);
+            Notify(event);
+
+            m_LevelService.SetBossActive(false);
+            m_Boss = nullptr;
+            m_LevelService.SetLevelCompleted(true);
+        } else {
+            pointsGained += NodeArchetypes::GetPoints(node->GetShape(), level);
+            m_RewardOrigins.push_back(position);
+        }
+    }
+
+    for (Node* node : m_RetiredNodes) {
+        m_NodesById.erase(node->GetId());
+        delete node;
+    }
+    m_RetiredNodes.clear();
+
+    if (m_RewardOrigins.empty()) {
+        return;
+    }
+
+    int destroyedCount = static_cast<int>(m_RewardOrigins.size());
+    m_PickupService.SpawnPointPickups(m_RewardOrigins);
+    m_NodesDestroyed += destroyedCount;
+    m_LevelService.AddNodesDestroyed(destroyedCount);
+
+    auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::NodesDestroyed);
+    event->count = destroyedCount;
+    event->points = pointsGained;
+    event->position = m_RewardOrigins.front();
+    event->positions = m_RewardOrigins;
+    Notify(event);
+}
+
+void Game::QueueExplosion(const Node& node) {
+    const NodeArchetype& archetype = NodeArchetypes::Get(node.GetShape());
+    if (archetype.explosionRadius <= 0.0f) {
+        return;
+    }
+
+    m_NextExplosionWave.push_back(PendingExplosion{node.GetPosition(), archetype.explosionRadius * node.GetSize(),
+                                                   archetype.explosionDamage * m_UpgradeService.GetDamagePerTick()});
+}
+
+void Game::ResolveExplosions() {
+    // Nodes that died since the last death stage seed the first wave, after any carry-over
+    m_NextExplosionWave.clear();
+    for (Node* node : m_Nodes) {
+        if (node->GetState() == NodeState::Dead) {
+            QueueExplosion(*node);
+        }
+    }
+    m_ExplosionWave.insert(m_ExplosionWave.end(), m_NextExplosionWave.begin(), m_NextExplosionWave.end());
+
+    if (m_ExplosionWave.empty()) {
+        return;
+    }
+
+    m_ExplosionTargets.clear();
+    m_ExplosionXs.clear();
+    m_ExplosionYs.clear();
+    float largestRadius = 0.0f;
+    float largestBlast = 0.0f;
+    for (Node* node : m_Nodes) {
+        if (node->GetState() != NodeState::Active) {
+            continue;
+        }
+        Position position = node->GetPosition();
+        m_ExplosionTargets.push_back(node);
+        m_ExplosionXs.push_back(position.x);
+        m_ExplosionYs.push_back(position.y);
+        largestRadius = std::max(largestRadius, node->GetSize() * NodeArchetypes::Get(node->GetShape()).radiusFactor);
+    }
+    for (const PendingExplosion& explosion : m_ExplosionWave) {
+        largestBlast = std::max(largestBlast, explosion.radius);
+    }
+
+    if (m_ExplosionTargets.empty()) {
+        m_ExplosionWave.clear();
+        return;
+    }
+
+    m_ExplosionGrid.Build(m_ExplosionXs.data(), m_ExplosionYs.data(), m_ExplosionTargets.size(),
+                          largestBlast + largestRadius);
+
+    int budget = GameConfig::CHAIN_EXPLOSIONS_PER_TICK;
+
+    // Breadth-first: every explosion in a wave uses positions from the start of the tick, and
+    // the nodes it kills form the next wave.
+    while (!m_ExplosionWave.empty() && budget > 0) {
+        m_NextExplosionWave.clear();
+        size_t resolved = 0;
+
+        for (; resolved < m_ExplosionWave.size() && budget > 0; ++resolved, --budget) {
+            const PendingExplosion& explosion = m_ExplosionWave[resolved];
+            float x = explosion.position.x;
+            float y = explosion.position.y;
+
+            m_ExplosionGrid.QueryRadius(x, y, explosion.radius + largestRadius, [&](uint32_t index) {
+                Node* target = m_ExplosionTargets[index];
+                if (target->GetState() != NodeState::Active) {
+                    return;
+                }
+
+                float reach = explosion.radius + target->GetSize() * NodeArchetypes::Get(target->GetShape()).radiusFactor;
+                float dx = m_ExplosionXs[index] - x;
+                float dy = m_ExplosionYs[index] - y;
+                if (dx * dx + dy * dy > reach * reach) {
+                    return;
+                }
+
+                target->TakeDamage(explosion.damage);
+                if (target->GetState() == NodeState::Dead) {
+                    QueueExplosion(*target);
+                }
+            });
+        }
+
+        // Out of budget mid-wave: keep the unresolved rest ahead of the wave it started
+        m_ExplosionWave.erase(m_ExplosionWave.begin(), m_ExplosionWave.begin() + resolved);
+        m_ExplosionWave.insert(m_ExplosionWave.end(), m_NextExplosionWave.begin(), m_NextExplosionWave.end());
+    }
+}
+
+void Game::ScheduleExit(Node* node) {
+    m_NodesById[node->GetId()] = node;
+
+    // The boss is never retired; it lingers until defeated.
+    if (node->GetShape() == NodeShape::Boss) {
+        return;
+    }
+
+    double exitTime = ComputeExitTime(*node);
+    if (std::isfinite(exitTime)) {
+        m_ExitQueue.push(NodeExit{exitTime, node->GetId()});
+    }
+}
+
+void Game::RetireExitedNodes() {
+    while (!m_ExitQueue.empty() && m_ExitQueue.top().time <= m_SimTime) {
+        auto it = m_NodesById.find(m_ExitQueue.top().nodeId);
+        m_ExitQueue.pop();
+
+        if (it == m_NodesById.end()) {
+            continue;
+        }
+
+        double exitTime = ComputeExitTime(*it->second);
+        if (exitTime > m_SimTime) {
+            m_ExitQueue.push(NodeExit{exitTime, it->first});
+        } else {
+            it->second->Retire();
+        }
+    }
+}
+
+void Game::SteerNodes(float deltaTime) {
+    size_t writeIndex = 0;
+    for (Node* node : m_SteeredNodes) {
+        const MovementProfile& profile = MovementProfiles::Get(node->GetMovement());
+        if (node->GetState() != NodeState::Active || m_SimTime - node->GetSpawnTime() > profile.steerDuration) {
+            // Done steering: the final straight path gets its own exit time
+            if (node->GetState() == NodeState::Active) {
+                ScheduleExit(node);
+            }
+            continue;
+        }
+        m_SteeredNodes[writeIndex++] = node;
+
+        // Turn toward the cursor by at most turnRate this tick
+        Position position = node->GetPosition();
+        float directionX = node->GetVelocityX();
+        float directionY = node->GetVelocityY();
+        float toCursorX = m_MouseX - position.x;
+        float toCursorY = m_MouseY - position.y;
+
+        float angle = std::atan2(directionX * toCursorY - directionY * toCursorX,
+                                 directionX * toCursorX + directionY * toCursorY);
+        float maxTurn = profile.turnRate * deltaTime * (FastMath::PI / 180.0f);
+        float turn = std::max(-maxTurn, std::min(maxTurn, angle));
+
+        float sine;
+        float cosine;
+        FastMath::SinCos(turn, sine, cosine);
+        node->SetDirection(directionX * cosine - directionY * sine, directionX * sine + directionY * cosine);
+    }
+    m_SteeredNodes.resize(writeIndex);
+}
+
+void Game::SeparateNodes(float deltaTime) {
+    m_SeparatingNodes.clear();
+    m_SeparationXs.clear();
+    m_SeparationYs.clear();
+    m_SeparationRadii.clear();
+
+    float largestRadius = 0.0f;
+    for (Node* node : m_Nodes) {
+        const NodeArchetype& archetype = NodeArchetypes::Get(node->GetShape());
+        if (!archetype.separates || node->GetState() != NodeState::Active) {
+            continue;
+        }
+
+        Position position = node->GetPosition();
+        float radius = node->GetSize() * archetype.radiusFactor;
+        m_SeparatingNodes.push_back(node);
+        m_SeparationXs.push_back(position.x);
+        m_SeparationYs.push_back(position.y);
+        m_SeparationRadii.push_back(radius);
+        largestRadius = std::max(largestRadius, radius);
+    }
+
+    size_t count = m_SeparatingNodes.size();
+    if (count < 2) {
+        return;
+    }
+
+    // Cells as wide as the largest contact distance keep each query to a 3x3 block
+    m_SeparationGrid.Build(m_SeparationXs.data(), m_SeparationYs.data(), count, 2.0f * largestRadius);
+    m_PushXs.assign(count, 0.0f);
+    m_PushYs.assign(count, 0.0f);
+
+    if (m_ThreadPool) {
+        m_ThreadPool->ParallelFor(count, GameConfig::NODE_SEPARATION_CHUNK,
+                                  [this](size_t begin, size_t end) { ComputeSeparation(begin, end); });
+    } else {
+        ComputeSeparation(0, count);
+    }
+
+    float scale = GameConfig::NODE_SEPARATION_STRENGTH * deltaTime;
+    for (size_t i = 0; i < count; ++i) {
+        if (m_PushXs[i] != 0.0f || m_PushYs[i] != 0.0f) {
+            m_SeparatingNodes[i]->Nudge(m_PushXs[i] * scale, m_PushYs[i] * scale);
+        }
+    }
+}
+
+void Game::ComputeSeparation(size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        float x = m_SeparationXs[i];
+        float y = m_SeparationYs[i];
+        float radius = m_SeparationRadii[i];
+        float pushX = 0.0f;
+        float pushY = 0.0f;
+
+        // Closest cells first, so the neighbor cap drops the farthest contacts in a crowd
+        m_SeparationGrid.QueryNeighbors(static_cast<uint32_t>(i), GameConfig::NODE_SEPARATION_MAX_NEIGHBORS,
+                                        [&](uint32_t j) {
+            float dx = x - m_SeparationXs[j];
+            float dy = y - m_SeparationYs[j];
+            float contact = radius + m_SeparationRadii[j];
+            float distanceSquared = dx * dx + dy * dy;
+            if (distanceSquared >= contact * contact) {
+                return false;
+            }
+
+            float distance = std::sqrt(distanceSquared);
+            float overlap = contact - distance;
+
+            // Coincident nodes split along an index-dependent axis so they do not stay stacked
+            if (distance < 1e-3f) {
+                dx = j < i ? 1.0f : -1.0f;
+                dy = 0.0f;
+                distance = 1.0f;
+            }
+
+            pushX += dx / distance * overlap;
+            pushY += dy / distance * overlap;
+            return true;
+        });
+
+        m_PushXs[i] = pushX;
+        m_PushYs[i] = pushY;
+    }
+}
+
+double Game::ComputeExitTime(const Node& node) const {
+    double startTime = node.GetPathStartTime();
+    Position origin = node.GetPositionAt(startTime);
+    double directionX = node.GetVelocityX();
+    double directionY = node.GetVelocityY();
+    // Wave and coil offsets can carry the node past the straight path by this much
+    double margin = GameConfig::NODE_RETIRE_MARGIN + node.GetPathDeviation();
+
+    auto axisExit = [](double position, double direction, double low, double high) {
+        if (direction > 0.0) {
+            return (high - position) / direction;
+        }
+        if (direction < 0.0) {
+            return (low - position) / direction;
+        }
+        return std::numeric_limits<double>::infinity();
+    };
+
+    double exitX = axisExit(origin.x, directionX, -margin, m_ScreenWidth + margin);
+    double exitY = axisExit(origin.y, directionY, -margin, m_ScreenHeight + margin);
+    double distance = std::max(0.0, std::min(exitX, exitY));
+    if (!std::isfinite(distance)) {
+        return distance;
+    }
+    return startTime + node.GetTravelTime(distance);
+}
+
+void Game::ClearNodes() {
+    for (Node* node : m_Nodes) {
+        delete node;
+    }
+    m_Nodes.clear();
+    m_NodesById.clear();
+    m_SteeredNodes.clear();
+    m_ExplosionWave.clear();
+    m_ExitQueue = decltype(m_ExitQueue)();
+}
+
 void Game::SpawnBoss() {
     if (m_LevelService.IsBossActive()) return;
 
     float bossSize = m_ScreenHeight * 0.15f;
-    float bossHP = GameConfig::BOSS_HP_BASE + (m_LevelService.GetCurrentLevel() - 1) * 100.0f;
+    float bossHP = m_LevelTable.Get(m_LevelService.GetCurrentLevel()).bossHP;
     m_Boss = CreateNode(NodeShape::Boss, bossSize, GameConfig::BOSS_SPEED);
 
     m_Boss->SetHP(bossHP);
 
     float spawnX, spawnY;
-    int edge = std::rand() % 4;
+    int edge = m_RandomService->NextInt(4);
     float offset = bossSize * 1.5f;
 
     switch (edge) {
         case 0:
-            spawnX = (static_cast<float>(std::rand()) / RAND_MAX) * m_ScreenWidth;
+            spawnX = m_RandomService->NextFloat() * m_ScreenWidth;
             spawnY = -offset;
             break;
         case 1:
             spawnX = m_ScreenWidth + offset;
-            spawnY = (static_cast<float>(std::rand()) / RAND_MAX) * m_ScreenHeight;
+            spawnY = m_RandomService->NextFloat() * m_ScreenHeight;
             break;
         case 2:
-            spawnX = (static_cast<float>(std::rand()) / RAND_MAX) * m_ScreenWidth;
+            spawnX = m_RandomService->NextFloat() * m_ScreenWidth;
             spawnY = m_ScreenHeight + offset;
             break;
         case 3:
             spawnX = -offset;
-            spawnY = (static_cast<float>(std::rand()) / RAND_MAX) * m_ScreenHeight;
+            spawnY = m_RandomService->NextFloat() * m_ScreenHeight;
             break;
     }
 
@@ -320,7 +984,9 @@ void Game::SpawnBoss() {
 
     m_Boss->SetDirection(dirX, dirY);
     m_Nodes.push_back(m_Boss);
+    ScheduleExit(m_Boss);
     m_LevelService.SetBossActive(true);
+    m_ScriptScheduler.Start(BehaviorScripts::Boss(), m_Boss->GetId(), m_SimTime);
 
     auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::BossSpawned);
     event->level = m_LevelService.GetCurrentLevel();
@@ -328,25 +994,118 @@ void Game::SpawnBoss() {
     Notify(event);
 }
 
+void Game::StartLevelScripts() {
+    m_ScriptScheduler.Clear();
+    if (m_GameMode == GameMode::Standard && m_LevelService.GetCurrentLevel() >= GameConfig::RING_WAVE_FIRST_LEVEL) {
+        m_ScriptScheduler.Start(BehaviorScripts::RingWave(), IScriptHost::NO_OWNER, m_SimTime);
+    }
+}
+
+bool Game::GetOwnerPosition(int ownerId, Position& position) const {
+    if (ownerId == IScriptHost::NO_OWNER) {
+        position = Position{m_ScreenWidth / 2.0f, m_ScreenHeight / 2.0f};
+        return true;
+    }
+
+    auto it = m_NodesById.find(ownerId);
+    if (it == m_NodesById.end() || it->second->GetState() != NodeState::Active) {
+        return false;
+    }
+    position = it->second->GetPosition();
+    return true;
+}
+
+float Game::GetOwnerHealthRatio(int ownerId) const {
+    auto it = m_NodesById.find(ownerId);
+    if (it == m_NodesById.end()) {
+        return 1.0f;
+    }
+    return it->second->GetHP() / it->second->GetMaxHP();
+}
+
+Position Game::GetAimTarget() const {
+    return Position{m_MouseX, m_MouseY};
+}
+
+float Game::NextRandomUnit() {
+    return m_RandomService->NextFloat();
+}
+
+void Game::FireRadial(const Position& origin, int count, float startAngle) {
+    m_ProjectileService.FireRadial(origin, count, GameConfig::PROJECTILE_SPEED, startAngle);
+}
+
+void Game::FireAimed(const Position& origin, const Position& target, int count, float spreadAngle) {
+    m_ProjectileService.FireAimed(origin, target, count, spreadAngle, GameConfig::PROJECTILE_SPEED);
+}
+
+void Game::SpawnRing(const Position& center, int count, float radius, NodeShape shape, bool inward) {
+    float step = 2.0f * FastMath::PI / std::max(1, count);
+    m_SpawnBatch.clear();
+    for (int i = 0; i < count; ++i) {
+        float cosine = std::cos(i * step);
+        float sine = std::sin(i * step);
+
+        SpawnInfo info;
+        info.position = Position{center.x + cosine * radius, center.y + sine * radius};
+        info.shape = shape;
+        info.directionX = inward ? -cosine : cosine;
+        info.directionY = inward ? -sine : sine;
+        m_SpawnBatch.push_back(info);
+    }
+    SpawnNodes(m_SpawnBatch);
+}
+
+float Game::MoveOwnerTo(int ownerId, float x, float y) {
+    auto it = m_NodesById.find(ownerId);
+    if (it == m_NodesById.end()) {
+        return 0.0f;
+    }
+
+    Node* node = it->second;
+    Position position = node->GetPosition();
+    float dx = x - position.x;
+    float dy = y - position.y;
+    float distance = std::sqrt(dx * dx + dy * dy);
+    if (distance <= 0.0f) {
+        node->SetDirection(0.0f, 0.0f);
+        return 0.0f;
+    }
+
+    node->SetDirection(dx / distance, dy / distance);
+    ScheduleExit(node);
+    return static_cast<float>(node->GetTravelTime(distance));
+}
+
+void Game::StopOwner(int ownerId) {
+    auto it = m_NodesById.find(ownerId);
+    if (it != m_NodesById.end()) {
+        it->second->SetDirection(0.0f, 0.0f);
+    }
+}
+
 void Game::StartNextLevel() {
     int oldLevel = m_LevelService.GetCurrentLevel();
     m_LevelService.StartNextLevel();
 
     SaveProgress();
+    m_RunPoints += m_PickupService.GetPickupPoints();
 
-    for (Node* node : m_Nodes) {
-        delete node;
-    }
-    m_Nodes.clear();
+    ClearNodes();
+    m_HasPreviousMouse = false;
 
     m_PickupService.Reset();
+    m_ProjectileService.Clear();
+    m_RewindService.Clear();
 
     m_SpawnService.ResetSpawnTimer();
-    m_SpawnService.SetCurrentLevel(m_LevelService.GetCurrentLevel());
+    ApplyLevelParams();
 
     m_HealthService.RestoreToMax();
 
     m_Boss = nullptr;
+    StartLevelScripts();
+    m_NextCheckpointTime = m_SimTime;
 
     auto event = std::make_shared<GameEvent>(m_ElapsedTime, EventType::LevelCompleted);
     event->level = oldLevel;
@@ -354,11 +1113,46 @@ void Game::StartNextLevel() {
     Notify(event);
 }
 
+void Game::SetGameMode(GameMode mode) {
+    m_GameMode = mode;
+}
+
+GameMode Game::GetGameMode() const {
+    return m_GameMode;
+}
+
 void Game::SetMousePosition(float x, float y) {
     m_MouseX = x;
     m_MouseY = y;
 }
 
+const LevelTable& Game::GetLevelTable() const {
+    return m_LevelTable;
+}
+
+void Game::SetLevelTable(const LevelTable& levelTable) {
+    m_LevelTable = levelTable;
+    ApplyLevelParams();
+}
+
+bool Game::LoadLevelTable(const std::string& filePath) {
+    if (!m_LevelTable.LoadFromFile(filePath)) {
+        return false;
+    }
+    ApplyLevelParams();
+    return true;
+}
+
+void Game::ApplyLevelParams() {
+    m_AppliedLevel = m_LevelService.GetCurrentLevel();
+    m_SpawnService.SetCurrentLevel(m_AppliedLevel);
+    m_HealthService.SetCurrentLevel(m_AppliedLevel);
+}
+
+Position Game::GetMousePosition() const {
+    return Position{m_MouseX, m_MouseY};
+}
+
 std::vector<PointPickup> Game::GetCollectedPickupsThisFrame() const {
     return m_CollectedPickupsThisFrame;
 }
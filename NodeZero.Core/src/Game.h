@@ -1,47 +1,147 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <queue>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "Config/LevelTable.h"
 #include "Events/Subject.h"
 #include "IGame.h"
 #include "Node.h"
+#include "Scripting/ScriptScheduler.h"
 #include "Services/DamageZoneService.h"
+#include "Services/GameServices.h"
 #include "Services/HealthService.h"
 #include "Services/LevelService.h"
 #include "Services/PickupService.h"
-#include "Services/SaveService.h"
+#include "Services/ProjectileService.h"
+#include "Services/RewindService.h"
 #include "Services/SpawnService.h"
 #include "Services/UpgradeService.h"
+#include "Simulation/ThreadPool.h"
+#include "Spatial/SpatialGrid.h"
+#include "Types/Checkpoint.h"
+#include "Types/DamageZone.h"
 #include "Types/PointPickup.h"
 
-class Game : public IGame {
+// Scheduled moment a node's current path leaves the playfield margin.
+struct NodeExit {
+    double time;
+    int nodeId;
+
+    bool operator>(const NodeExit& other) const { return time > other.time; }
+};
+
+// Area damage left by a node that died with an explosive archetype.
+struct PendingExplosion {
+    Position position;
+    float radius;
+    float damage;
+};
+
+class Game : public IGame, private IScriptHost {
    private:
     Subject m_Subject;
     std::vector<Node*> m_Nodes;
+    // Interface view of m_Nodes handed out by GetNodes
+    mutable std::vector<INode*> m_NodeViews;
     float m_ScreenWidth;
     float m_ScreenHeight;
     float m_ElapsedTime;
+    // Clock all nodes evaluate their motion against.
+    double m_SimTime;
+    // Cost of the last Update, read from m_ClockService
+    double m_UpdateMilliseconds;
 
     int m_NodesDestroyed;
+    // Points of the levels already finished this run; the current level's are in m_PickupService
+    int m_RunPoints;
+    // EndRun has recorded this run
+    bool m_RunEnded;
     int m_HighPoints;
 
     Node* m_Boss;
 
     float m_MouseX;
     float m_MouseY;
+    // Cursor at the previous tick; collection sweeps from here to the current cursor.
+    float m_PreviousMouseX;
+    float m_PreviousMouseY;
+    bool m_HasPreviousMouse;
     std::vector<PointPickup> m_CollectedPickupsThisFrame;
+    std::vector<DamageZone> m_DamageZones;
+
+    // Scratch storage for the death stage, reused every frame.
+    std::vector<Node*> m_RetiredNodes;
+    std::vector<Position> m_RewardOrigins;
+
+    // Exit times are known at spawn, so retirement only pops what is due. Entries for
+    // nodes that died first are skipped when popped; entries made stale by steering are
+    // pushed back with the recomputed time.
+    std::priority_queue<NodeExit, std::vector<NodeExit>, std::greater<NodeExit>> m_ExitQueue;
+    std::unordered_map<int, Node*> m_NodesById;
+    int m_NextNodeId;
+
+    // Nodes whose behavior steers toward the cursor; every other behavior is closed-form.
+    std::vector<Node*> m_SteeredNodes;
+
+    // Separation scratch, one entry per separating node. Pushes are computed from a
+    // snapshot of positions, so chunks can run in parallel.
+    ThreadPool* m_ThreadPool;
+    SpatialGrid m_SeparationGrid;
+    std::vector<Node*> m_SeparatingNodes;
+    std::vector<float> m_SeparationXs;
+    std::vector<float> m_SeparationYs;
+    std::vector<float> m_SeparationRadii;
+    std::vector<float> m_PushXs;
+    std::vector<float> m_PushYs;
+
+    // Chain explosions: the current and next breadth-first wave, plus the grid of nodes
+    // they can reach. Waves past the per-tick cap stay in m_ExplosionWave for next tick.
+    std::vector<PendingExplosion> m_ExplosionWave;
+    std::vector<PendingExplosion> m_NextExplosionWave;
+    SpatialGrid m_ExplosionGrid;
+    std::vector<Node*> m_ExplosionTargets;
+    std::vector<float> m_ExplosionXs;
+    std::vector<float> m_ExplosionYs;
+
+    // Nodes due to spawn this tick, handed to SpawnNodes in one batch.
+    std::vector<SpawnInfo> m_SpawnBatch;
+
+    GameMode m_GameMode;
+
+    LevelTable m_LevelTable;
+    int m_AppliedLevel;
+
+    // Boss phases and level waves run as scripts against m_SimTime.
+    ScriptScheduler m_ScriptScheduler;
 
     UpgradeService m_UpgradeService;
     PickupService m_PickupService;
+    ProjectileService m_ProjectileService;
     HealthService m_HealthService;
     SpawnService m_SpawnService;
     LevelService m_LevelService;
     DamageZoneService m_DamageZoneService;
-    SaveService m_SaveService;
+    RewindService m_RewindService;
+    WorldSnapshot m_RewindSnapshot;
+    std::unique_ptr<ISaveService> m_SaveService;
+    std::unique_ptr<IRandomService> m_RandomService;
+    std::unique_ptr<IClockService> m_ClockService;
+    std::unique_ptr<ICheckpointService> m_CheckpointService;
+    std::unique_ptr<IRunHistoryService> m_RunHistoryService;
+
+    Checkpoint m_Checkpoint;
+    double m_NextCheckpointTime;
+    // A checkpoint of this run or level has been submitted and not yet discarded
+    bool m_HasCheckpoint;
 
    public:
     Game();
+    explicit Game(GameServices services);
     ~Game();
 
     void Initialize(float screenWidth, float screenHeight) override;
@@ -49,26 +149,51 @@ class Game : public IGame {
     void Reset() override;
     void StartNextLevel() override;
 
+    void SetGameMode(GameMode mode) override;
+    GameMode GetGameMode() const override;
+
     void SetMousePosition(float x, float y) override;
+    Position GetMousePosition() const override;
     void SpawnNode(const SpawnInfo& info) override;
+    void SpawnNodes(const std::vector<SpawnInfo>& infos) override;
 
     float GetScreenWidth() const override;
     float GetScreenHeight() const override;
 
+    void CaptureSnapshot(WorldSnapshot& snapshot) const override;
+    size_t GetNodeCount() const override;
     const std::vector<INode*>& GetNodes() const override;
     std::vector<PointPickup> GetCollectedPickupsThisFrame() const override;
 
     int GetNodesDestroyed() const override;
     void SaveProgress() override;
+    void EndRun() override;
     int GetHighPoints() const override;
+    bool ResumeFromCheckpoint() override;
+    void CaptureCheckpoint(Checkpoint& checkpoint) const;
+    double GetSimTime() const;
+    // Crowd separation runs its chunks on this pool; nullptr (the default) keeps it on the
+    // calling thread. The pool must outlive the game.
+    void SetThreadPool(ThreadPool* threadPool);
+
+    const LevelTable& GetLevelTable() const override;
+    void SetLevelTable(const LevelTable& levelTable);
+    bool LoadLevelTable(const std::string& filePath);
 
     IUpgradeService& GetUpgradeService() override;
     IPickupService& GetPickupService() override;
+    IProjectileService& GetProjectileService() override;
+    IRewindService& GetRewindService() override;
     IHealthService& GetHealthService() override;
     ILevelService& GetLevelService() override;
     IDamageZoneService& GetDamageZoneService() override;
     ISpawnService& GetSpawnService() override;
     ISaveService& GetSaveService() override;
+    IRandomService& GetRandomService() override;
+    double GetUpdateMilliseconds() const override;
+    IClockService& GetClockService() override;
+    ICheckpointService& GetCheckpointService() override;
+    IRunHistoryService& GetRunHistoryService() override;
 
     void Attach(std::shared_ptr<IObserver> observer) override;
     void Detach(std::shared_ptr<IObserver> observer) override;
@@ -76,5 +201,31 @@ class Game : public IGame {
 
    private:
     Node* CreateNode(NodeShape shape, float size, float speed);
+    Node* AddSpawnedNode(const SpawnInfo& info);
     void SpawnBoss();
+    void ProcessDeaths();
+    void StartLevelScripts();
+    void ResolveExplosions();
+    void QueueExplosion(const Node& node);
+    void ScheduleExit(Node* node);
+    void RetireExitedNodes();
+    void SteerNodes(float deltaTime);
+    void SeparateNodes(float deltaTime);
+    void ComputeSeparation(size_t begin, size_t end);
+    double ComputeExitTime(const Node& node) const;
+    void ClearNodes();
+    void ApplyLevelParams();
+    void UpdateCheckpoint();
+    void StoreProgress(bool runEnded);
+
+    // IScriptHost
+    bool GetOwnerPosition(int ownerId, Position& position) const override;
+    float GetOwnerHealthRatio(int ownerId) const override;
+    Position GetAimTarget() const override;
+    float NextRandomUnit() override;
+    void FireRadial(const Position& origin, int count, float startAngle) override;
+    void FireAimed(const Position& origin, const Position& target, int count, float spreadAngle) override;
+    void SpawnRing(const Position& center, int count, float radius, NodeShape shape, bool inward) override;
+    float MoveOwnerTo(int ownerId, float x, float y) override;
+    void StopOwner(int ownerId) override;
 };
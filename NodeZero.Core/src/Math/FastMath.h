@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Branch-free helpers written so that loops over plain float arrays auto-vectorize.
+namespace FastMath {
+
+constexpr float PI = 3.14159265358979f;
+constexpr float TWO_PI = 6.28318530718f;
+
+// Largest absolute error of SinCos against std::sin/std::cos for |angle| <= 1000,
+// checked by the tests.
+constexpr float SINCOS_MAX_ERROR = 2e-6f;
+
+// Quadrant reduction to [-pi/4, pi/4] followed by Taylor polynomials
+// (sin to x^7, cos to x^8).
+inline void SinCos(float angle, float& sinOut, float& cosOut) {
+    constexpr float TWO_OVER_PI = 0.636619772367581f;
+    // pi/2 split in two parts so the reduction stays exact for moderate angles
+    constexpr float HALF_PI_HI = 1.5703125f;
+    constexpr float HALF_PI_LO = 4.83826794897e-4f;
+
+    // Round to nearest without std::floor, which blocks vectorization unless trapping math is off
+    float scaled = angle * TWO_OVER_PI;
+    float quadrant = static_cast<float>(static_cast<int>(scaled + (scaled >= 0.0f ? 0.5f : -0.5f)));
+    float x = (angle - quadrant * HALF_PI_HI) - quadrant * HALF_PI_LO;
+    float x2 = x * x;
+
+    float s = x * (1.0f + x2 * (-1.0f / 6.0f + x2 * (1.0f / 120.0f + x2 * (-1.0f / 5040.0f))));
+    float c = 1.0f + x2 * (-0.5f + x2 * (1.0f / 24.0f + x2 * (-1.0f / 720.0f + x2 * (1.0f / 40320.0f))));
+
+    int q = static_cast<int>(quadrant) & 3;
+    float swappedSin = (q & 1) ? c : s;
+    float swappedCos = (q & 1) ? s : c;
+    sinOut = (q & 2) ? -swappedSin : swappedSin;
+    cosOut = ((q + 1) & 2) ? -swappedCos : swappedCos;
+}
+
+inline void SinCos(const float* __restrict angles, float* __restrict sinOut, float* __restrict cosOut, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        SinCos(angles[i], sinOut[i], cosOut[i]);
+    }
+}
+
+// xorshift32 step; state must be non-zero.
+inline uint32_t NextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// Uniform float in [0, 1) from the top 24 bits.
+inline float NextUnit(uint32_t& state) {
+    return static_cast<float>(NextRandom(state) >> 8) * (1.0f / 16777216.0f);
+}
+
+}  // namespace FastMath
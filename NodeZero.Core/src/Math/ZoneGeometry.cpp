@@ -0,0 +1,385 @@
+#include "Math/ZoneGeometry.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Math/FastMath.h"
+
+namespace ZoneGeometry {
+
+namespace {
+
+constexpr float DEG_TO_RAD = FastMath::PI / 180.0f;
+
+// Kernels take the node centers relative to the zone center. Each loop body is
+// straight-line arithmetic so the compiler can vectorize it.
+
+void BroadPhaseRectangle(const ZoneFrame& frame, const float* __restrict xs, const float* __restrict ys,
+                         const float* __restrict radii, uint8_t* __restrict hits, size_t count) {
+    const float cx = frame.centerX;
+    const float cy = frame.centerY;
+    const float cosR = frame.cosRotation;
+    const float sinR = frame.sinRotation;
+    const float hw = frame.halfWidth;
+    const float hh = frame.halfHeight;
+
+    for (size_t i = 0; i < count; ++i) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        float localX = dx * cosR + dy * sinR;
+        float localY = dy * cosR - dx * sinR;
+        float outsideX = std::max(std::fabs(localX) - hw, 0.0f);
+        float outsideY = std::max(std::fabs(localY) - hh, 0.0f);
+        hits[i] = static_cast<uint8_t>(outsideX * outsideX + outsideY * outsideY <= radii[i] * radii[i]);
+    }
+}
+
+void BroadPhaseCircle(const ZoneFrame& frame, const float* __restrict xs, const float* __restrict ys,
+                      const float* __restrict radii, uint8_t* __restrict hits, size_t count) {
+    const float cx = frame.centerX;
+    const float cy = frame.centerY;
+    const float outer = frame.outerRadius;
+
+    for (size_t i = 0; i < count; ++i) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        float reach = outer + radii[i];
+        hits[i] = static_cast<uint8_t>(dx * dx + dy * dy <= reach * reach);
+    }
+}
+
+void BroadPhaseRing(const ZoneFrame& frame, const float* __restrict xs, const float* __restrict ys,
+                    const float* __restrict radii, uint8_t* __restrict hits, size_t count) {
+    const float cx = frame.centerX;
+    const float cy = frame.centerY;
+    const float outer = frame.outerRadius;
+    const float inner = frame.innerRadius;
+
+    for (size_t i = 0; i < count; ++i) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        float distanceSquared = dx * dx + dy * dy;
+        float reach = outer + radii[i];
+        float hole = std::max(inner - radii[i], 0.0f);
+        hits[i] = static_cast<uint8_t>((distanceSquared <= reach * reach) & (distanceSquared >= hole * hole));
+    }
+}
+
+// Conservative: the bounding circle must reach the disk and both (or, past 180 degrees,
+// either) half-planes bounding the wedge.
+void BroadPhaseCone(const ZoneFrame& frame, const float* __restrict xs, const float* __restrict ys,
+                    const float* __restrict radii, uint8_t* __restrict hits, size_t count) {
+    const float cx = frame.centerX;
+    const float cy = frame.centerY;
+    const float cosR = frame.cosRotation;
+    const float sinR = frame.sinRotation;
+    const float outer = frame.outerRadius;
+    const float cosH = frame.cosHalfSpread;
+    const float sinH = frame.sinHalfSpread;
+    const bool convex = cosH >= 0.0f;
+
+    for (size_t i = 0; i < count; ++i) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        float localX = dx * cosR + dy * sinR;
+        float localY = dy * cosR - dx * sinR;
+        float reach = outer + radii[i];
+        // Signed distances past the upper and lower edges of the wedge
+        float pastUpper = localY * cosH - localX * sinH;
+        float pastLower = -localY * cosH - localX * sinH;
+        bool withinUpper = pastUpper <= radii[i];
+        bool withinLower = pastLower <= radii[i];
+        bool angular = convex ? (withinUpper & withinLower) : (withinUpper | withinLower);
+        hits[i] = static_cast<uint8_t>((dx * dx + dy * dy <= reach * reach) & angular);
+    }
+}
+
+float Cross(float ax, float ay, float bx, float by) {
+    return ax * by - ay * bx;
+}
+
+float SegmentDistanceSquared(float px, float py, float ax, float ay, float bx, float by) {
+    float ex = bx - ax;
+    float ey = by - ay;
+    float lengthSquared = ex * ex + ey * ey;
+    float t = lengthSquared > 0.0f ? ((px - ax) * ex + (py - ay) * ey) / lengthSquared : 0.0f;
+    t = std::max(0.0f, std::min(1.0f, t));
+    float qx = ax + ex * t - px;
+    float qy = ay + ey * t - py;
+    return qx * qx + qy * qy;
+}
+
+bool SegmentsIntersect(float ax, float ay, float bx, float by, float cx, float cy, float dx, float dy) {
+    float d1 = Cross(bx - ax, by - ay, cx - ax, cy - ay);
+    float d2 = Cross(bx - ax, by - ay, dx - ax, dy - ay);
+    float d3 = Cross(dx - cx, dy - cy, ax - cx, ay - cy);
+    float d4 = Cross(dx - cx, dy - cy, bx - cx, by - cy);
+    return ((d1 <= 0.0f && d2 >= 0.0f) || (d1 >= 0.0f && d2 <= 0.0f)) &&
+           ((d3 <= 0.0f && d4 >= 0.0f) || (d3 >= 0.0f && d4 <= 0.0f));
+}
+
+struct Polygon {
+    float xs[MAX_OUTLINE_SIDES];
+    float ys[MAX_OUTLINE_SIDES];
+    int count;
+};
+
+bool ContainsPoint(const Polygon& polygon, float px, float py) {
+    bool anyPositive = false;
+    bool anyNegative = false;
+    for (int i = 0; i < polygon.count; ++i) {
+        int next = (i + 1) % polygon.count;
+        float side = Cross(polygon.xs[next] - polygon.xs[i], polygon.ys[next] - polygon.ys[i],
+                           px - polygon.xs[i], py - polygon.ys[i]);
+        anyPositive |= side > 0.0f;
+        anyNegative |= side < 0.0f;
+    }
+    return !(anyPositive && anyNegative);
+}
+
+// Separating axis test against the box |x| <= hw, |y| <= hh.
+bool PolygonHitsBox(const Polygon& polygon, float hw, float hh) {
+    float minX = polygon.xs[0];
+    float maxX = polygon.xs[0];
+    float minY = polygon.ys[0];
+    float maxY = polygon.ys[0];
+    for (int i = 1; i < polygon.count; ++i) {
+        minX = std::min(minX, polygon.xs[i]);
+        maxX = std::max(maxX, polygon.xs[i]);
+        minY = std::min(minY, polygon.ys[i]);
+        maxY = std::max(maxY, polygon.ys[i]);
+    }
+    if (minX > hw || maxX < -hw || minY > hh || maxY < -hh) {
+        return false;
+    }
+
+    for (int i = 0; i < polygon.count; ++i) {
+        int next = (i + 1) % polygon.count;
+        float normalX = polygon.ys[next] - polygon.ys[i];
+        float normalY = polygon.xs[i] - polygon.xs[next];
+
+        float low = polygon.xs[0] * normalX + polygon.ys[0] * normalY;
+        float high = low;
+        for (int k = 1; k < polygon.count; ++k) {
+            float projection = polygon.xs[k] * normalX + polygon.ys[k] * normalY;
+            low = std::min(low, projection);
+            high = std::max(high, projection);
+        }
+
+        float boxExtent = hw * std::fabs(normalX) + hh * std::fabs(normalY);
+        if (low > boxExtent || high < -boxExtent) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PolygonHitsDisk(const Polygon& polygon, float radius) {
+    if (ContainsPoint(polygon, 0.0f, 0.0f)) {
+        return true;
+    }
+    float radiusSquared = radius * radius;
+    for (int i = 0; i < polygon.count; ++i) {
+        int next = (i + 1) % polygon.count;
+        if (SegmentDistanceSquared(0.0f, 0.0f, polygon.xs[i], polygon.ys[i], polygon.xs[next], polygon.ys[next]) <=
+            radiusSquared) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool InSector(const ZoneFrame& frame, float px, float py) {
+    float distanceSquared = px * px + py * py;
+    return distanceSquared <= frame.outerRadius * frame.outerRadius &&
+           px >= std::sqrt(distanceSquared) * frame.cosHalfSpread;
+}
+
+// Convex polygon against the sector: one contains a point of the other, or the outlines cross.
+bool PolygonHitsSector(const ZoneFrame& frame, const Polygon& polygon) {
+    for (int i = 0; i < polygon.count; ++i) {
+        if (InSector(frame, polygon.xs[i], polygon.ys[i])) {
+            return true;
+        }
+    }
+    if (ContainsPoint(polygon, 0.0f, 0.0f)) {
+        return true;
+    }
+
+    float radius = frame.outerRadius;
+    float edgeX = radius * frame.cosHalfSpread;
+    float edgeY = radius * frame.sinHalfSpread;
+
+    for (int i = 0; i < polygon.count; ++i) {
+        int next = (i + 1) % polygon.count;
+        float ax = polygon.xs[i];
+        float ay = polygon.ys[i];
+        float bx = polygon.xs[next];
+        float by = polygon.ys[next];
+
+        if (SegmentsIntersect(ax, ay, bx, by, 0.0f, 0.0f, edgeX, edgeY) ||
+            SegmentsIntersect(ax, ay, bx, by, 0.0f, 0.0f, edgeX, -edgeY)) {
+            return true;
+        }
+
+        // Edge against the arc: solve |a + t(b - a)| = radius, keep roots on the edge inside the wedge
+        float ex = bx - ax;
+        float ey = by - ay;
+        float a = ex * ex + ey * ey;
+        float b = 2.0f * (ax * ex + ay * ey);
+        float c = ax * ax + ay * ay - radius * radius;
+        float discriminant = b * b - 4.0f * a * c;
+        if (a <= 0.0f || discriminant < 0.0f) {
+            continue;
+        }
+        float root = std::sqrt(discriminant);
+        for (float t : {(-b - root) / (2.0f * a), (-b + root) / (2.0f * a)}) {
+            if (t >= 0.0f && t <= 1.0f && ax + ex * t >= radius * frame.cosHalfSpread) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool CircleHitsSector(const ZoneFrame& frame, float px, float py, float radius) {
+    if (InSector(frame, px, py)) {
+        return true;
+    }
+
+    float radiusSquared = radius * radius;
+    float edgeX = frame.outerRadius * frame.cosHalfSpread;
+    float edgeY = frame.outerRadius * frame.sinHalfSpread;
+    if (SegmentDistanceSquared(px, py, 0.0f, 0.0f, edgeX, edgeY) <= radiusSquared ||
+        SegmentDistanceSquared(px, py, 0.0f, 0.0f, edgeX, -edgeY) <= radiusSquared) {
+        return true;
+    }
+
+    // Inside the wedge but beyond the arc; outside the wedge the arc's nearest point is an edge end
+    float distance = std::sqrt(px * px + py * py);
+    return px >= distance * frame.cosHalfSpread && distance - frame.outerRadius <= radius;
+}
+
+}  // namespace
+
+ZoneFrame MakeFrame(const DamageZone& zone) {
+    ZoneFrame frame{};
+    frame.shape = zone.shape;
+    frame.centerX = zone.centerX;
+    frame.centerY = zone.centerY;
+    frame.rotation = zone.rotation;
+    FastMath::SinCos(zone.rotation * DEG_TO_RAD, frame.sinRotation, frame.cosRotation);
+
+    float halfSize = zone.size / 2.0f;
+    switch (zone.shape) {
+        case DamageZoneShape::Square:
+            frame.halfWidth = halfSize;
+            frame.halfHeight = halfSize;
+            break;
+        case DamageZoneShape::Rectangle:
+            frame.halfWidth = halfSize;
+            frame.halfHeight = zone.innerSize / 2.0f;
+            break;
+        case DamageZoneShape::Circle:
+            frame.outerRadius = halfSize;
+            break;
+        case DamageZoneShape::Ring:
+            frame.outerRadius = halfSize;
+            frame.innerRadius = std::min(zone.innerSize / 2.0f, halfSize);
+            break;
+        case DamageZoneShape::Cone: {
+            frame.outerRadius = zone.size;
+            float halfSpread = std::max(0.0f, std::min(zone.spreadAngle, 360.0f)) * 0.5f * DEG_TO_RAD;
+            FastMath::SinCos(halfSpread, frame.sinHalfSpread, frame.cosHalfSpread);
+            break;
+        }
+    }
+
+    frame.boundingRadius = std::max(frame.outerRadius, std::sqrt(frame.halfWidth * frame.halfWidth +
+                                                                  frame.halfHeight * frame.halfHeight));
+    return frame;
+}
+
+void BroadPhase(const ZoneFrame& frame, const float* xs, const float* ys, const float* radii, uint8_t* hits,
+                size_t count) {
+    switch (frame.shape) {
+        case DamageZoneShape::Square:
+        case DamageZoneShape::Rectangle:
+            BroadPhaseRectangle(frame, xs, ys, radii, hits, count);
+            break;
+        case DamageZoneShape::Circle:
+            BroadPhaseCircle(frame, xs, ys, radii, hits, count);
+            break;
+        case DamageZoneShape::Ring:
+            BroadPhaseRing(frame, xs, ys, radii, hits, count);
+            break;
+        case DamageZoneShape::Cone:
+            BroadPhaseCone(frame, xs, ys, radii, hits, count);
+            break;
+    }
+}
+
+bool Intersects(const ZoneFrame& frame, const NodeOutline& outline) {
+    float dx = outline.x - frame.centerX;
+    float dy = outline.y - frame.centerY;
+    float localX = dx * frame.cosRotation + dy * frame.sinRotation;
+    float localY = dy * frame.cosRotation - dx * frame.sinRotation;
+
+    if (outline.sides < 3) {
+        float radiusSquared = outline.radius * outline.radius;
+        switch (frame.shape) {
+            case DamageZoneShape::Square:
+            case DamageZoneShape::Rectangle: {
+                float outsideX = std::max(std::fabs(localX) - frame.halfWidth, 0.0f);
+                float outsideY = std::max(std::fabs(localY) - frame.halfHeight, 0.0f);
+                return outsideX * outsideX + outsideY * outsideY <= radiusSquared;
+            }
+            case DamageZoneShape::Circle:
+            case DamageZoneShape::Ring: {
+                float distance = std::sqrt(localX * localX + localY * localY);
+                return distance <= frame.outerRadius + outline.radius &&
+                       distance + outline.radius >= frame.innerRadius;
+            }
+            case DamageZoneShape::Cone:
+                return CircleHitsSector(frame, localX, localY, outline.radius);
+        }
+        return false;
+    }
+
+    Polygon polygon;
+    polygon.count = std::min(outline.sides, MAX_OUTLINE_SIDES);
+    float step = 360.0f / polygon.count;
+    for (int i = 0; i < polygon.count; ++i) {
+        float sine;
+        float cosine;
+        FastMath::SinCos((outline.rotation - frame.rotation + i * step) * DEG_TO_RAD, sine, cosine);
+        polygon.xs[i] = localX + outline.radius * cosine;
+        polygon.ys[i] = localY + outline.radius * sine;
+    }
+
+    switch (frame.shape) {
+        case DamageZoneShape::Square:
+        case DamageZoneShape::Rectangle:
+            return PolygonHitsBox(polygon, frame.halfWidth, frame.halfHeight);
+        case DamageZoneShape::Circle:
+            return PolygonHitsDisk(polygon, frame.outerRadius);
+        case DamageZoneShape::Ring: {
+            if (!PolygonHitsDisk(polygon, frame.outerRadius)) {
+                return false;
+            }
+            // Convex, so it misses the ring only when every corner sits inside the hole
+            float holeSquared = frame.innerRadius * frame.innerRadius;
+            for (int i = 0; i < polygon.count; ++i) {
+                if (polygon.xs[i] * polygon.xs[i] + polygon.ys[i] * polygon.ys[i] >= holeSquared) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        case DamageZoneShape::Cone:
+            return PolygonHitsSector(frame, polygon);
+    }
+    return false;
+}
+
+}  // namespace ZoneGeometry
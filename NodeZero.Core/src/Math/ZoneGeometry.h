@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Types/DamageZone.h"
+
+// Intersection tests between damage zones and node outlines. The broad phase runs one
+// branch-free kernel per zone shape over columns of node bounding circles; the narrow
+// phase is exact against the node's true outline.
+namespace ZoneGeometry {
+
+constexpr int MAX_OUTLINE_SIDES = 8;
+
+// A zone resolved into its local frame: x runs along the zone's rotation.
+struct ZoneFrame {
+    DamageZoneShape shape;
+    float centerX;
+    float centerY;
+    float cosRotation;
+    float sinRotation;
+    float rotation;
+    float halfWidth;
+    float halfHeight;
+    float outerRadius;
+    float innerRadius;
+    float cosHalfSpread;
+    float sinHalfSpread;
+    // Radius of a circle around the center containing the whole zone.
+    float boundingRadius;
+};
+
+// A node's collision outline: a circle when sides is 0, otherwise a regular polygon with
+// corners at radius, the first one at rotation degrees.
+struct NodeOutline {
+    float x;
+    float y;
+    float radius;
+    int sides;
+    float rotation;
+};
+
+ZoneFrame MakeFrame(const DamageZone& zone);
+
+// hits[i] = 1 when the circle (xs[i], ys[i], radii[i]) may touch the zone, else 0.
+void BroadPhase(const ZoneFrame& frame, const float* xs, const float* ys, const float* radii, uint8_t* hits,
+                size_t count);
+
+bool Intersects(const ZoneFrame& frame, const NodeOutline& outline);
+
+}  // namespace ZoneGeometry
@@ -1,22 +1,84 @@
 #include "Node.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include <limits>
+
+#include "Config/GameConfig.h"
+#include "Config/MovementProfiles.h"
+#include "Config/NodeArchetypes.h"
+
 Node::Node(NodeShape shape, float size, float speed)
-    : m_Position(0.0f, 0.0f), m_Shape(shape), m_State(NodeState::Inactive), m_Size(size), m_Speed(speed), m_VelocityX(0.0f), m_VelocityY(0.0f), m_Rotation(0.0f) {
-    if (shape == NodeShape::Boss) {
-        m_MaxHP = 1.0f;
-        m_HP = 1.0f;
-    } else {
-        m_MaxHP = size * 2.0f;
-        m_HP = m_MaxHP;
+    : m_Id(0),
+      m_Origin(0.0f, 0.0f),
+      m_Shape(shape),
+      m_State(NodeState::Inactive),
+      m_Size(size),
+      m_Speed(speed),
+      m_VelocityX(0.0f),
+      m_VelocityY(0.0f),
+      m_StartRotation(0.0f),
+      m_SpawnTime(0.0),
+      m_StartTime(0.0),
+      m_EndTime(0.0),
+      m_Clock(nullptr),
+      m_LocalTime(0.0) {
+    m_MaxHP = NodeArchetypes::GetMaxHP(shape, size);
+    m_HP = m_MaxHP;
+    SetMovement(MovementBehavior::Linear);
+}
+
+Position Node::GetPosition() const {
+    return GetPositionAt(Now());
+}
+
+Position Node::GetPositionAt(double time) const {
+    // Motion stops when the node dies or is retired
+    if (m_State != NodeState::Active) {
+        time = std::min(time, m_EndTime);
+    }
+
+    double elapsed = std::max(0.0, time - m_StartTime);
+    double coilPhase = m_CoilFrequency * elapsed;
+    double along = GetTravelDistance(elapsed) + m_CoilRadius * std::sin(coilPhase);
+    double lateral = m_WaveAmplitude * std::sin(m_WaveFrequency * elapsed) + m_CoilRadius * (1.0 - std::cos(coilPhase));
+
+    return Position{static_cast<float>(m_Origin.x + m_VelocityX * along - m_VelocityY * lateral),
+                    static_cast<float>(m_Origin.y + m_VelocityY * along + m_VelocityX * lateral)};
+}
+
+double Node::GetTravelDistance(double elapsed) const {
+    double ramp = std::min(elapsed, m_RampDuration);
+    return m_InitialSpeed * ramp + 0.5 * m_Acceleration * ramp * ramp + m_SpeedLimit * (elapsed - ramp);
+}
+
+double Node::GetTravelTime(double distance) const {
+    double rampDistance = GetTravelDistance(m_RampDuration);
+    if (distance <= rampDistance && m_Acceleration != 0.0f) {
+        // Inside the ramp: solve initialSpeed * t + acceleration * t^2 / 2 = distance
+        double discriminant = static_cast<double>(m_InitialSpeed) * m_InitialSpeed + 2.0 * m_Acceleration * distance;
+        return (std::sqrt(std::max(0.0, discriminant)) - m_InitialSpeed) / m_Acceleration;
+    }
+
+    if (m_SpeedLimit <= 0.0f) {
+        return std::numeric_limits<double>::infinity();
     }
+    return m_RampDuration + (distance - rampDistance) / m_SpeedLimit;
 }
 
-Position& Node::GetPosition() {
-    return m_Position;
+float Node::GetPathDeviation() const {
+    return std::abs(m_WaveAmplitude) + 2.0f * std::abs(m_CoilRadius);
 }
 
-const Position& Node::GetPosition() const {
-    return m_Position;
+float Node::GetRotationAt(double time) const {
+    if (m_State != NodeState::Active) {
+        time = std::min(time, m_EndTime);
+    }
+
+    double elapsed = std::max(0.0, time - m_StartTime);
+    double rotation = std::fmod(m_StartRotation + GameConfig::NODE_ROTATION_SPEED * elapsed, 360.0);
+    return static_cast<float>(rotation);
 }
 
 NodeShape Node::GetShape() const {
@@ -36,7 +98,7 @@ float Node::GetSpeed() const {
 }
 
 float Node::GetRotation() const {
-    return m_Rotation;
+    return GetRotationAt(Now());
 }
 
 float Node::GetHP() const {
@@ -59,31 +121,49 @@ void Node::TakeDamage(float damage) {
 }
 
 void Node::Spawn(float x, float y) {
-    m_Position.x = x;
-    m_Position.y = y;
+    m_Origin = Position{x, y};
+    m_SpawnTime = Now();
+    m_StartTime = m_SpawnTime;
+    m_StartRotation = 0.0f;
     m_State = NodeState::Active;
     m_HP = m_MaxHP;
 }
 
 void Node::SetDirection(float dirX, float dirY) {
+    // Re-base the motion so the path stays continuous
+    double now = Now();
+    m_Origin = GetPositionAt(now);
+    m_StartRotation = GetRotationAt(now);
+    m_StartTime = now;
     m_VelocityX = dirX;
     m_VelocityY = dirY;
 }
 
+void Node::Nudge(float offsetX, float offsetY) {
+    if (m_State != NodeState::Active) {
+        return;
+    }
+    m_Origin.x += offsetX;
+    m_Origin.y += offsetY;
+}
+
 void Node::Kill() {
+    if (m_State == NodeState::Active) {
+        m_EndTime = Now();
+    }
     m_State = NodeState::Dead;
 }
 
-void Node::Update(float deltaTime) {
-    if (m_State != NodeState::Active)
-        return;
-
-    m_Position.x += m_VelocityX * m_Speed * deltaTime;
-    m_Position.y += m_VelocityY * m_Speed * deltaTime;
+void Node::Retire() {
+    if (m_State == NodeState::Active) {
+        m_EndTime = Now();
+        m_State = NodeState::Inactive;
+    }
+}
 
-    m_Rotation += 30.0f * deltaTime;
-    if (m_Rotation >= 360.0f) {
-        m_Rotation -= 360.0f;
+void Node::Update(float deltaTime) {
+    if (!m_Clock) {
+        m_LocalTime += deltaTime;
     }
 }
 
@@ -91,3 +171,85 @@ void Node::SetHP(float hp) {
     m_MaxHP = hp;
     m_HP = hp;
 }
+
+void Node::SetClock(const double* clock) {
+    m_Clock = clock;
+}
+
+void Node::SetId(int id) {
+    m_Id = id;
+}
+
+int Node::GetId() const {
+    return m_Id;
+}
+
+double Node::GetSpawnTime() const {
+    return m_SpawnTime;
+}
+
+double Node::GetPathStartTime() const {
+    return m_StartTime;
+}
+
+void Node::SetMovement(MovementBehavior movement) {
+    const MovementProfile& profile = MovementProfiles::Get(movement);
+    m_Movement = movement;
+    m_InitialSpeed = profile.initialSpeed * m_Speed;
+    m_Acceleration = profile.acceleration * m_Speed;
+    m_SpeedLimit = profile.speedLimit * m_Speed;
+    m_RampDuration = profile.acceleration != 0.0f
+                         ? std::max(0.0, static_cast<double>(m_SpeedLimit - m_InitialSpeed) / m_Acceleration)
+                         : 0.0;
+    m_WaveAmplitude = profile.waveAmplitude * m_Size;
+    m_WaveFrequency = profile.waveFrequency;
+    m_CoilRadius = profile.coilRadius * m_Size;
+    m_CoilFrequency = profile.coilFrequency;
+}
+
+MovementBehavior Node::GetMovement() const {
+    return m_Movement;
+}
+
+float Node::GetVelocityX() const {
+    return m_VelocityX;
+}
+
+float Node::GetVelocityY() const {
+    return m_VelocityY;
+}
+
+void Node::SaveCheckpoint(NodeCheckpoint& checkpoint) const {
+    checkpoint.id = m_Id;
+    checkpoint.shape = static_cast<uint8_t>(m_Shape);
+    checkpoint.movement = static_cast<uint8_t>(m_Movement);
+    checkpoint.originX = m_Origin.x;
+    checkpoint.originY = m_Origin.y;
+    checkpoint.size = m_Size;
+    checkpoint.speed = m_Speed;
+    checkpoint.hp = m_HP;
+    checkpoint.maxHp = m_MaxHP;
+    checkpoint.velocityX = m_VelocityX;
+    checkpoint.velocityY = m_VelocityY;
+    checkpoint.startRotation = m_StartRotation;
+    checkpoint.spawnTime = m_SpawnTime;
+    checkpoint.startTime = m_StartTime;
+}
+
+void Node::LoadCheckpoint(const NodeCheckpoint& checkpoint) {
+    m_Id = checkpoint.id;
+    m_Origin = Position{checkpoint.originX, checkpoint.originY};
+    m_HP = checkpoint.hp;
+    m_MaxHP = checkpoint.maxHp;
+    m_VelocityX = checkpoint.velocityX;
+    m_VelocityY = checkpoint.velocityY;
+    m_StartRotation = checkpoint.startRotation;
+    m_SpawnTime = checkpoint.spawnTime;
+    m_StartTime = checkpoint.startTime;
+    m_State = NodeState::Active;
+    SetMovement(static_cast<MovementBehavior>(checkpoint.movement));
+}
+
+double Node::Now() const {
+    return m_Clock ? *m_Clock : m_LocalTime;
+}
@@ -1,10 +1,17 @@
 #pragma once
 
+#include "Enums/MovementBehavior.h"
 #include "INode.h"
+#include "Types/Checkpoint.h"
 
-class Node : public INode {
+// Position and rotation are closed-form functions of time since the last Spawn/SetDirection:
+// a speed ramp along the direction plus the wave and coil offsets of the node's
+// MovementProfile. Nothing is integrated per frame; reads evaluate the motion against the
+// clock the node is attached to. Steered behaviors re-base the path through SetDirection.
+class Node final : public INode {
    private:
-    Position m_Position;
+    int m_Id;
+    Position m_Origin;
     NodeShape m_Shape;
     NodeState m_State;
     float m_Size;
@@ -13,13 +20,32 @@ class Node : public INode {
     float m_MaxHP;
     float m_VelocityX;
     float m_VelocityY;
-    float m_Rotation;
+    float m_StartRotation;
+    double m_SpawnTime;
+    double m_StartTime;
+    double m_EndTime;
+
+    // Movement profile scaled to this node's speed and size
+    MovementBehavior m_Movement;
+    float m_InitialSpeed;
+    float m_Acceleration;
+    float m_SpeedLimit;
+    double m_RampDuration;
+    float m_WaveAmplitude;
+    float m_WaveFrequency;
+    float m_CoilRadius;
+    float m_CoilFrequency;
+
+    // Shared simulation clock, or m_LocalTime when the node is used on its own.
+    const double* m_Clock;
+    double m_LocalTime;
 
    public:
     Node(NodeShape shape, float size, float speed);
 
-    Position& GetPosition() override;
-    const Position& GetPosition() const override;
+    Position GetPosition() const override;
+    Position GetPositionAt(double time) const;
+    float GetRotationAt(double time) const;
 
     NodeShape GetShape() const override;
     NodeState GetState() const override;
@@ -33,9 +59,38 @@ class Node : public INode {
 
     void Spawn(float x, float y) override;
     void SetDirection(float dirX, float dirY) override;
+    // Shifts the whole path, leaving speed, phase and direction untouched.
+    void Nudge(float offsetX, float offsetY);
+    // Only advances the local clock; nodes attached to a shared clock ignore it.
     void Update(float deltaTime) override;
     void Kill() override;
+    // Leaves the playfield without dying: no rewards, motion frozen.
+    void Retire();
     void TakeDamage(float damage) override;
 
     void SetHP(float hp);
+    void SetClock(const double* clock);
+    void SetId(int id);
+    int GetId() const;
+    double GetSpawnTime() const;
+    double GetPathStartTime() const;
+
+    void SetMovement(MovementBehavior movement);
+    MovementBehavior GetMovement() const;
+    // Distance covered along the direction after elapsed seconds on the current path.
+    double GetTravelDistance(double elapsed) const;
+    // Seconds on the current path until the node has covered distance along its direction.
+    double GetTravelTime(double distance) const;
+    // Furthest the wave and coil offsets can push the node off its straight path.
+    float GetPathDeviation() const;
+    float GetVelocityX() const;
+    float GetVelocityY() const;
+
+    // Only active nodes are checkpointed. Loading puts the node back on the same path,
+    // active, with the id it had; the shape, size and speed must match its construction.
+    void SaveCheckpoint(NodeCheckpoint& checkpoint) const;
+    void LoadCheckpoint(const NodeCheckpoint& checkpoint);
+
+   private:
+    double Now() const;
 };
@@ -0,0 +1,62 @@
+#include "BehaviorScripts.h"
+
+#include "Config/GameConfig.h"
+
+namespace {
+
+void AttackCycle(Script& script, int radialCount, int spiralArms, float interval) {
+    script.AimRandom().FireRadial(radialCount).Wait(interval);
+
+    script.AimRandom();
+    size_t volley = script.Here();
+    script.FireRadial(spiralArms)
+        .Turn(GameConfig::BOSS_SPIRAL_TURN)
+        .Wait(GameConfig::BOSS_SPIRAL_VOLLEY_INTERVAL)
+        .Repeat(volley, GameConfig::BOSS_SPIRAL_VOLLEYS)
+        .Wait(interval);
+
+    script.FireAimed(GameConfig::BOSS_AIMED_COUNT, GameConfig::BOSS_AIMED_SPREAD).Wait(interval);
+}
+
+Script BuildBoss() {
+    Script script;
+    script.MoveTo(0.5f, 0.3f).Wait(GameConfig::BOSS_ATTACK_INTERVAL);
+
+    size_t calm = script.Here();
+    AttackCycle(script, GameConfig::BOSS_RADIAL_COUNT, GameConfig::BOSS_SPIRAL_ARMS,
+                GameConfig::BOSS_ATTACK_INTERVAL);
+    // The enraged cycle starts right after the two jumps below
+    size_t enrage = script.Here() + 2;
+    script.JumpIfHealthBelow(GameConfig::BOSS_ENRAGE_HEALTH, enrage).Jump(calm);
+
+    script.SpawnRing(GameConfig::BOSS_MINION_COUNT, 0.15f, NodeShape::Square, false);
+    AttackCycle(script, GameConfig::BOSS_RADIAL_COUNT * 3 / 2, GameConfig::BOSS_SPIRAL_ARMS * 2,
+                GameConfig::BOSS_ENRAGED_ATTACK_INTERVAL);
+    script.Jump(enrage);
+    return script;
+}
+
+Script BuildRingWave() {
+    Script script;
+    size_t start = script.Here();
+    script.Wait(GameConfig::RING_WAVE_INTERVAL)
+        .SpawnRing(GameConfig::RING_WAVE_COUNT, GameConfig::RING_WAVE_RADIUS, NodeShape::Circle, true)
+        .Jump(start);
+    return script;
+}
+
+}  // namespace
+
+namespace BehaviorScripts {
+
+const Script& Boss() {
+    static const Script script = BuildBoss();
+    return script;
+}
+
+const Script& RingWave() {
+    static const Script script = BuildRingWave();
+    return script;
+}
+
+}  // namespace BehaviorScripts
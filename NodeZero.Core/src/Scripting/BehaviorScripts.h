@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Scripting/Script.h"
+
+// The game's built-in scripts, built once on first use.
+namespace BehaviorScripts {
+
+// Walks in, then cycles radial burst, spiral and aimed fan. Below BOSS_ENRAGE_HEALTH it
+// switches to a faster cycle that also sheds a ring of minions.
+const Script& Boss();
+
+// Ownerless level script: a ring of nodes converging on the screen center every
+// RING_WAVE_INTERVAL seconds.
+const Script& RingWave();
+
+}  // namespace BehaviorScripts
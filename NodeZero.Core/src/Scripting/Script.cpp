@@ -0,0 +1,73 @@
+#include "Script.h"
+
+#include <algorithm>
+
+Script::Script()
+    : m_LoopCount(0) {
+}
+
+size_t Script::Here() const {
+    return m_Code.size();
+}
+
+const std::vector<ScriptInstruction>& Script::GetCode() const {
+    return m_Code;
+}
+
+Script& Script::Emit(ScriptOp op, int count, float a, float b, size_t target) {
+    m_Code.push_back(ScriptInstruction{op, count, a, b, static_cast<uint32_t>(target), 0, NodeShape::Circle});
+    return *this;
+}
+
+Script& Script::Wait(float seconds) {
+    return Emit(ScriptOp::Wait, 0, seconds);
+}
+
+Script& Script::Aim(float degrees) {
+    return Emit(ScriptOp::Aim, 0, degrees);
+}
+
+Script& Script::AimRandom() {
+    return Emit(ScriptOp::AimRandom);
+}
+
+Script& Script::Turn(float degrees) {
+    return Emit(ScriptOp::Turn, 0, degrees);
+}
+
+Script& Script::FireRadial(int count) {
+    return Emit(ScriptOp::FireRadial, count);
+}
+
+Script& Script::FireAimed(int count, float spreadAngle) {
+    return Emit(ScriptOp::FireAimed, count, spreadAngle);
+}
+
+Script& Script::SpawnRing(int count, float radius, NodeShape shape, bool inward) {
+    Emit(ScriptOp::SpawnRing, count, radius, inward ? 1.0f : 0.0f);
+    m_Code.back().shape = shape;
+    return *this;
+}
+
+Script& Script::MoveTo(float x, float y) {
+    Emit(ScriptOp::MoveTo, 0, x, y);
+    return Stop();
+}
+
+Script& Script::Stop() {
+    return Emit(ScriptOp::Stop);
+}
+
+Script& Script::Jump(size_t target) {
+    return Emit(ScriptOp::Jump, 0, 0.0f, 0.0f, target);
+}
+
+Script& Script::Repeat(size_t target, int times) {
+    Emit(ScriptOp::Repeat, times, 0.0f, 0.0f, target);
+    m_Code.back().loopSlot = static_cast<uint8_t>(std::min(m_LoopCount++, MAX_LOOPS - 1));
+    return *this;
+}
+
+Script& Script::JumpIfHealthBelow(float fraction, size_t target) {
+    return Emit(ScriptOp::JumpIfHealthBelow, 0, fraction, 0.0f, target);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Enums/NodeShape.h"
+
+enum class ScriptOp {
+    Wait,
+    Aim,
+    AimRandom,
+    Turn,
+    FireRadial,
+    FireAimed,
+    SpawnRing,
+    MoveTo,
+    Stop,
+    Jump,
+    Repeat,
+    JumpIfHealthBelow
+};
+
+struct ScriptInstruction {
+    ScriptOp op;
+    int count;
+    float a;
+    float b;
+    uint32_t target;
+    uint8_t loopSlot;
+    NodeShape shape;
+};
+
+// A behavior written as a flat list of instructions, run by ScriptScheduler. Each running
+// copy keeps its own program counter, aim angle and loop counters, so one script can drive
+// any number of entities. Build scripts by chaining the methods below; jump targets are
+// instruction indices taken from Here().
+class Script {
+   public:
+    static constexpr int MAX_LOOPS = 4;
+
+   private:
+    std::vector<ScriptInstruction> m_Code;
+    int m_LoopCount;
+
+   public:
+    Script();
+
+    size_t Here() const;
+    const std::vector<ScriptInstruction>& GetCode() const;
+
+    // Suspends the script; it resumes on the first tick at or after the wake time.
+    Script& Wait(float seconds);
+
+    // The aim angle (degrees) is used by FireRadial as the angle of its first projectile.
+    Script& Aim(float degrees);
+    Script& AimRandom();
+    Script& Turn(float degrees);
+
+    Script& FireRadial(int count);
+    Script& FireAimed(int count, float spreadAngle);
+    // Spawns count nodes on a circle of radius (fraction of screen height) around the
+    // owner, heading outward, or inward when inward is set.
+    Script& SpawnRing(int count, float radius, NodeShape shape, bool inward);
+
+    // Moves the owner to a point given as fractions of the screen, waits for it to
+    // arrive and stops it there.
+    Script& MoveTo(float x, float y);
+    Script& Stop();
+
+    Script& Jump(size_t target);
+    // Runs the instructions from target up to here times times in total. Each Repeat
+    // has its own counter; past MAX_LOOPS of them the last counter is shared.
+    Script& Repeat(size_t target, int times);
+    Script& JumpIfHealthBelow(float fraction, size_t target);
+
+   private:
+    Script& Emit(ScriptOp op, int count = 0, float a = 0.0f, float b = 0.0f, size_t target = 0);
+};
@@ -0,0 +1,168 @@
+#include "ScriptScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+ScriptScheduler::ScriptScheduler()
+    : m_RunningCount(0) {
+}
+
+ScriptHandle ScriptScheduler::Start(const Script& script, int ownerId, double startTime) {
+    uint32_t slot;
+    if (!m_FreeSlots.empty()) {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(m_Contexts.size());
+        m_Contexts.push_back(Context{});
+        m_Contexts.back().generation = 0;
+    }
+
+    Context& context = m_Contexts[slot];
+    context.script = &script;
+    context.ownerId = ownerId;
+    context.pc = 0;
+    context.angle = 0.0f;
+    context.running = true;
+    context.loopCounters.fill(0);
+    m_RunningCount++;
+
+    Schedule(slot, startTime);
+    return ScriptHandle{slot, context.generation};
+}
+
+void ScriptScheduler::Stop(ScriptHandle handle) {
+    if (IsRunning(handle)) {
+        Release(handle.slot);
+    }
+}
+
+bool ScriptScheduler::IsRunning(ScriptHandle handle) const {
+    return handle.slot < m_Contexts.size() && m_Contexts[handle.slot].running &&
+           m_Contexts[handle.slot].generation == handle.generation;
+}
+
+void ScriptScheduler::Clear() {
+    // Release rather than drop the slots so handles held elsewhere go stale
+    for (uint32_t slot = 0; slot < m_Contexts.size(); ++slot) {
+        if (m_Contexts[slot].running) {
+            Release(slot);
+        }
+    }
+    m_WakeHeap.clear();
+}
+
+void ScriptScheduler::Update(double now, IScriptHost& host) {
+    while (!m_WakeHeap.empty() && m_WakeHeap.front().time <= now) {
+        std::pop_heap(m_WakeHeap.begin(), m_WakeHeap.end(), std::greater<Wake>());
+        Wake wake = m_WakeHeap.back();
+        m_WakeHeap.pop_back();
+
+        // Entries of stopped scripts are left in the heap and skipped here
+        const Context& context = m_Contexts[wake.slot];
+        if (!context.running || context.generation != wake.generation) {
+            continue;
+        }
+
+        Resume(wake.slot, wake.time, now, host);
+    }
+}
+
+void ScriptScheduler::Resume(uint32_t slot, double wakeTime, double now, IScriptHost& host) {
+    const std::vector<ScriptInstruction>& code = m_Contexts[slot].script->GetCode();
+    int ownerId = m_Contexts[slot].ownerId;
+
+    Position origin;
+    if (!host.GetOwnerPosition(ownerId, origin)) {
+        Release(slot);
+        return;
+    }
+
+    // Waits count from when the script was due, not from this tick, so a fixed cadence
+    // holds at any frame rate; a wait that is already over resumes within this Update.
+    double nextTick = std::nextafter(now, std::numeric_limits<double>::infinity());
+    auto suspend = [&](float seconds) {
+        Schedule(slot, seconds > 0.0f ? wakeTime + seconds : nextTick);
+    };
+
+    for (int step = 0; step < MAX_STEPS_PER_RESUME; ++step) {
+        // Host calls may start scripts and grow m_Contexts, so the context is looked up each step
+        Context& context = m_Contexts[slot];
+        if (context.pc >= code.size()) {
+            Release(slot);
+            return;
+        }
+
+        const ScriptInstruction& instruction = code[context.pc++];
+        switch (instruction.op) {
+            case ScriptOp::Wait:
+                suspend(instruction.a);
+                return;
+            case ScriptOp::Aim:
+                context.angle = instruction.a;
+                break;
+            case ScriptOp::AimRandom:
+                context.angle = host.NextRandomUnit() * 360.0f;
+                break;
+            case ScriptOp::Turn:
+                context.angle += instruction.a;
+                break;
+            case ScriptOp::FireRadial:
+                host.FireRadial(origin, instruction.count, context.angle);
+                break;
+            case ScriptOp::FireAimed:
+                host.FireAimed(origin, host.GetAimTarget(), instruction.count, instruction.a);
+                break;
+            case ScriptOp::SpawnRing:
+                host.SpawnRing(origin, instruction.count, instruction.a * host.GetScreenHeight(), instruction.shape,
+                               instruction.b > 0.0f);
+                break;
+            case ScriptOp::MoveTo:
+                suspend(host.MoveOwnerTo(ownerId, instruction.a * host.GetScreenWidth(),
+                                         instruction.b * host.GetScreenHeight()));
+                return;
+            case ScriptOp::Stop:
+                host.StopOwner(ownerId);
+                break;
+            case ScriptOp::Jump:
+                context.pc = instruction.target;
+                break;
+            case ScriptOp::Repeat: {
+                int& counter = context.loopCounters[instruction.loopSlot];
+                if (++counter < instruction.count) {
+                    context.pc = instruction.target;
+                } else {
+                    counter = 0;
+                }
+                break;
+            }
+            case ScriptOp::JumpIfHealthBelow:
+                if (host.GetOwnerHealthRatio(ownerId) < instruction.a) {
+                    context.pc = instruction.target;
+                }
+                break;
+        }
+    }
+
+    // Out of steps without a wait (a loop with no Wait in it): carry on next tick
+    suspend(0.0f);
+}
+
+void ScriptScheduler::Schedule(uint32_t slot, double time) {
+    m_WakeHeap.push_back(Wake{time, slot, m_Contexts[slot].generation});
+    std::push_heap(m_WakeHeap.begin(), m_WakeHeap.end(), std::greater<Wake>());
+}
+
+void ScriptScheduler::Release(uint32_t slot) {
+    Context& context = m_Contexts[slot];
+    context.running = false;
+    context.generation++;
+    m_FreeSlots.push_back(slot);
+    m_RunningCount--;
+}
+
+size_t ScriptScheduler::GetRunningCount() const {
+    return m_RunningCount;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Scripting/Script.h"
+#include "Types/Position.h"
+
+// What a running script may read and do. Owner ids are node ids; NO_OWNER scripts are
+// anchored at the screen center and never end on their own.
+class IScriptHost {
+   public:
+    static constexpr int NO_OWNER = -1;
+
+    virtual ~IScriptHost() = default;
+
+    // Returns false once the owner is gone, which ends the script.
+    virtual bool GetOwnerPosition(int ownerId, Position& position) const = 0;
+    virtual float GetOwnerHealthRatio(int ownerId) const = 0;
+    virtual Position GetAimTarget() const = 0;
+    virtual float NextRandomUnit() = 0;
+
+    virtual void FireRadial(const Position& origin, int count, float startAngle) = 0;
+    virtual void FireAimed(const Position& origin, const Position& target, int count, float spreadAngle) = 0;
+    virtual void SpawnRing(const Position& center, int count, float radius, NodeShape shape, bool inward) = 0;
+    // Starts the owner toward (x, y) in pixels and returns the travel time in seconds.
+    virtual float MoveOwnerTo(int ownerId, float x, float y) = 0;
+    virtual void StopOwner(int ownerId) = 0;
+    virtual float GetScreenWidth() const = 0;
+    virtual float GetScreenHeight() const = 0;
+};
+
+struct ScriptHandle {
+    uint32_t slot;
+    uint32_t generation;
+};
+
+// Runs scripts cooperatively against the simulation clock. Running scripts live in a
+// pooled slot array; suspended ones sit in a min-heap by wake time, so a tick only touches
+// the scripts that are due and thousands of idle ones cost nothing.
+class ScriptScheduler {
+   public:
+    // A resume that runs this many instructions without waiting yields until the next tick.
+    static constexpr int MAX_STEPS_PER_RESUME = 64;
+
+   private:
+    struct Context {
+        const Script* script;
+        int ownerId;
+        uint32_t pc;
+        uint32_t generation;
+        float angle;
+        bool running;
+        std::array<int, Script::MAX_LOOPS> loopCounters;
+    };
+
+    struct Wake {
+        double time;
+        uint32_t slot;
+        uint32_t generation;
+
+        bool operator>(const Wake& other) const {
+            return time > other.time;
+        }
+    };
+
+    std::vector<Context> m_Contexts;
+    std::vector<uint32_t> m_FreeSlots;
+    std::vector<Wake> m_WakeHeap;
+    size_t m_RunningCount;
+
+   public:
+    ScriptScheduler();
+
+    // The script must outlive every copy started from it. The first resume happens on the
+    // first Update at or after startTime.
+    ScriptHandle Start(const Script& script, int ownerId, double startTime);
+    void Stop(ScriptHandle handle);
+    bool IsRunning(ScriptHandle handle) const;
+    void Clear();
+
+    void Update(double now, IScriptHost& host);
+
+    size_t GetRunningCount() const;
+
+   private:
+    void Resume(uint32_t slot, double wakeTime, double now, IScriptHost& host);
+    void Schedule(uint32_t slot, double time);
+    void Release(uint32_t slot);
+};
@@ -0,0 +1,156 @@
+#include "CheckpointService.h"
+
+#include <cstdio>
+#include <utility>
+
+#include "Storage/CheckpointFormat.h"
+#include "Storage/MappedFile.h"
+#include "Storage/SavePath.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static constexpr const char* CHECKPOINT_FILE_NAME = "checkpoint.dat";
+
+CheckpointService::CheckpointService(const std::string& path)
+    : m_Path(path.empty() ? GetSaveFilePath(CHECKPOINT_FILE_NAME) : path),
+      m_Request(Request::None),
+      m_Busy(false),
+      m_HasCheckpoint(false),
+      m_Stopping(false) {
+    // A file that does not read back whole is treated as no checkpoint
+    Checkpoint checkpoint;
+    m_HasCheckpoint = Load(checkpoint);
+}
+
+CheckpointService::~CheckpointService() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+    if (m_Writer.joinable()) {
+        m_Writer.join();
+    }
+}
+
+void CheckpointService::Submit(Checkpoint& checkpoint) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        StartWriter();
+        std::swap(m_Pending, checkpoint);
+        m_Request = Request::Write;
+        m_HasCheckpoint = true;
+    }
+    m_Condition.notify_all();
+}
+
+bool CheckpointService::Load(Checkpoint& checkpoint) {
+    MappedFile file;
+    if (!file.Open(m_Path)) {
+        return false;
+    }
+    return CheckpointFormat::Read(file.GetData(), file.GetSize(), checkpoint);
+}
+
+bool CheckpointService::HasCheckpoint() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_HasCheckpoint;
+}
+
+void CheckpointService::Discard() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        StartWriter();
+        m_Request = Request::Remove;
+        m_HasCheckpoint = false;
+    }
+    m_Condition.notify_all();
+}
+
+void CheckpointService::Flush() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Condition.wait(lock, [this]() { return m_Request == Request::None && !m_Busy; });
+}
+
+const std::string& CheckpointService::GetPath() const {
+    return m_Path;
+}
+
+void CheckpointService::StartWriter() {
+    // Games that never checkpoint never start a thread
+    if (!m_Writer.joinable()) {
+        m_Writer = std::thread(&CheckpointService::RunWriter, this);
+    }
+}
+
+void CheckpointService::RunWriter() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true) {
+        m_Condition.wait(lock, [this]() { return m_Request != Request::None || m_Stopping; });
+        // Whatever is pending still goes out before stopping
+        if (m_Request == Request::None) {
+            return;
+        }
+
+        Request request = m_Request;
+        m_Request = Request::None;
+        if (request == Request::Write) {
+            std::swap(m_Writing, m_Pending);
+        }
+        m_Busy = true;
+        lock.unlock();
+
+        if (request == Request::Write) {
+            CheckpointFormat::Write(m_Writing, m_Bytes);
+            WriteBytes(m_Bytes);
+        } else {
+            std::remove(m_Path.c_str());
+        }
+
+        lock.lock();
+        m_Busy = false;
+        m_Condition.notify_all();
+    }
+}
+
+bool CheckpointService::WriteBytes(const std::vector<uint8_t>& bytes) const {
+    std::string temporaryPath = m_Path + ".tmp";
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(temporaryPath.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    DWORD written = 0;
+    bool ok = WriteFile(file, bytes.data(), static_cast<DWORD>(bytes.size()), &written, NULL) &&
+              written == bytes.size() && FlushFileBuffers(file);
+    CloseHandle(file);
+    if (!ok) {
+        return false;
+    }
+    return MoveFileExA(temporaryPath.c_str(), m_Path.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    int descriptor = open(temporaryPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descriptor < 0) {
+        return false;
+    }
+    size_t offset = 0;
+    while (offset < bytes.size()) {
+        ssize_t written = write(descriptor, bytes.data() + offset, bytes.size() - offset);
+        if (written <= 0) {
+            close(descriptor);
+            return false;
+        }
+        offset += static_cast<size_t>(written);
+    }
+    // The data must be on disk before the rename makes it the checkpoint
+    bool ok = fsync(descriptor) == 0;
+    close(descriptor);
+    return ok && rename(temporaryPath.c_str(), m_Path.c_str()) == 0;
+#endif
+}
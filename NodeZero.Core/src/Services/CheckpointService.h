@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Services/ICheckpointService.h"
+
+// Writes checkpoints to a file on a background thread. Submit only swaps the checkpoint
+// into a pending slot; the writer encodes it, writes a temporary file, flushes it to disk
+// and renames it over the previous one, so a crash at any point leaves the last complete
+// checkpoint in place. A checkpoint that arrives while one is being written waits in the
+// slot, and a newer one replaces it there.
+class CheckpointService : public ICheckpointService {
+   private:
+    enum class Request {
+        None,
+        Write,
+        Remove
+    };
+
+    std::string m_Path;
+
+    std::thread m_Writer;
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    Request m_Request;
+    bool m_Busy;
+    Checkpoint m_Pending;
+    bool m_HasCheckpoint;
+    bool m_Stopping;
+
+    // Writer-thread only
+    Checkpoint m_Writing;
+    std::vector<uint8_t> m_Bytes;
+
+   public:
+    // An empty path uses checkpoint.dat in the save directory.
+    explicit CheckpointService(const std::string& path = "");
+    ~CheckpointService() override;
+
+    void Submit(Checkpoint& checkpoint) override;
+    bool Load(Checkpoint& checkpoint) override;
+    bool HasCheckpoint() const override;
+    void Discard() override;
+
+    // Blocks until every submitted checkpoint and discard has reached the disk.
+    void Flush();
+    const std::string& GetPath() const;
+
+   private:
+    void StartWriter();
+    void RunWriter();
+    bool WriteBytes(const std::vector<uint8_t>& bytes) const;
+};
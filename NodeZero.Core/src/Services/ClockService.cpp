@@ -0,0 +1,10 @@
+#include "ClockService.h"
+
+ClockService::ClockService()
+    : m_Start(std::chrono::steady_clock::now()) {
+}
+
+double ClockService::GetTime() const {
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_Start;
+    return elapsed.count();
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <chrono>
+
+#include "Services/IClockService.h"
+
+class ClockService : public IClockService {
+   private:
+    std::chrono::steady_clock::time_point m_Start;
+
+   public:
+    ClockService();
+    ~ClockService() override = default;
+
+    double GetTime() const override;
+};
@@ -2,14 +2,18 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 
+#include "Config/NodeArchetypes.h"
 #include "Enums/NodeShape.h"
 #include "Enums/NodeState.h"
+#include "Math/ZoneGeometry.h"
 #include "Node.h"
 
 DamageZoneService::DamageZoneService()
     : m_DamageTimer(0.0f),
-      m_DamageInterval(1.5f) {
+      m_DamageInterval(1.5f),
+      m_LevelTable(&LevelTable::Default()) {
 }
 
 void DamageZoneService::UpdateTimer(float deltaTime) {
@@ -24,6 +28,10 @@ bool DamageZoneService::ShouldDealDamage() const {
     return m_DamageTimer >= m_DamageInterval;
 }
 
+void DamageZoneService::SetLevelTable(const LevelTable* levelTable) {
+    m_LevelTable = levelTable ? levelTable : &LevelTable::Default();
+}
+
 void DamageZoneService::ProcessDamageZone(
     float centerX,
     float centerY,
@@ -33,49 +41,112 @@ void DamageZoneService::ProcessDamageZone(
     const std::vector<Node*>& nodes,
     std::function<void(Node*, float)> onNodeDamaged) {
 
-    float damageRectX = centerX - zoneSize / 2.0f;
-    float damageRectY = centerY - zoneSize / 2.0f;
-    float damageRectRight = damageRectX + zoneSize;
-    float damageRectBottom = damageRectY + zoneSize;
+    m_SingleZone.assign(1, DamageZone{centerX, centerY, zoneSize, damage});
+
+    ProcessDamageZones(m_SingleZone, currentLevel, nodes, [&onNodeDamaged](Node* node, float healthCost, size_t) {
+        if (onNodeDamaged) {
+            onNodeDamaged(node, healthCost);
+        }
+    });
+}
+
+void DamageZoneService::ProcessDamageZones(
+    const std::vector<DamageZone>& zones,
+    int currentLevel,
+    const std::vector<Node*>& nodes,
+    std::function<void(Node*, float, size_t)> onNodeDamaged) {
+
+    size_t zoneCount = zones.size();
+    if (zoneCount == 0) {
+        return;
+    }
 
+    m_ZoneFrames.resize(zoneCount);
+    float unionMinX = zones[0].centerX;
+    float unionMinY = zones[0].centerY;
+    float unionMaxX = unionMinX;
+    float unionMaxY = unionMinY;
+    for (size_t z = 0; z < zoneCount; ++z) {
+        ZoneGeometry::ZoneFrame& frame = m_ZoneFrames[z];
+        frame = ZoneGeometry::MakeFrame(zones[z]);
+        unionMinX = std::min(unionMinX, frame.centerX - frame.boundingRadius);
+        unionMinY = std::min(unionMinY, frame.centerY - frame.boundingRadius);
+        unionMaxX = std::max(unionMaxX, frame.centerX + frame.boundingRadius);
+        unionMaxY = std::max(unionMaxY, frame.centerY + frame.boundingRadius);
+    }
+
+    // Bounding circles of the active nodes near any zone, in columns for the broad-phase kernels
+    m_Candidates.clear();
+    m_NodeXs.clear();
+    m_NodeYs.clear();
+    m_NodeRadii.clear();
     for (Node* node : nodes) {
         if (node->GetState() != NodeState::Active)
             continue;
 
-        float nodeX = node->GetPosition().x;
-        float nodeY = node->GetPosition().y;
-        float nodeSize = node->GetSize();
-
-        float boundingRadius = nodeSize;
-        NodeShape shape = node->GetShape();
-        if (shape == NodeShape::Square) {
-            boundingRadius = nodeSize * 1.414f;
-        } else if (shape == NodeShape::Boss) {
-            boundingRadius = nodeSize * 1.414f;
+        Position nodePosition = node->GetPosition();
+        float boundingRadius = node->GetSize() * NodeArchetypes::Get(node->GetShape()).radiusFactor;
+        if (nodePosition.x + boundingRadius < unionMinX || nodePosition.x - boundingRadius > unionMaxX ||
+            nodePosition.y + boundingRadius < unionMinY || nodePosition.y - boundingRadius > unionMaxY) {
+            continue;
         }
 
-        float closestX = std::max(damageRectX, std::min(nodeX, damageRectRight));
-        float closestY = std::max(damageRectY, std::min(nodeY, damageRectBottom));
+        m_Candidates.push_back(node);
+        m_NodeXs.push_back(nodePosition.x);
+        m_NodeYs.push_back(nodePosition.y);
+        m_NodeRadii.push_back(boundingRadius);
+    }
+
+    size_t candidateCount = m_Candidates.size();
+    if (candidateCount == 0) {
+        return;
+    }
+
+    m_BroadHits.resize(candidateCount);
+    m_GroupsHit.assign(candidateCount, 0);
+    float healthCostScale = m_LevelTable->Get(currentLevel).healthCostScale;
 
-        float deltaX = nodeX - closestX;
-        float deltaY = nodeY - closestY;
-        float distanceSquared = deltaX * deltaX + deltaY * deltaY;
+    for (size_t z = 0; z < zoneCount; ++z) {
+        const DamageZone& zone = zones[z];
+        const ZoneGeometry::ZoneFrame& frame = m_ZoneFrames[z];
+        uint32_t groupBit = zone.group >= 0 ? (1u << (zone.group & 31)) : 0u;
 
-        bool inDamageZone = distanceSquared <= (boundingRadius * boundingRadius);
+        ZoneGeometry::BroadPhase(frame, m_NodeXs.data(), m_NodeYs.data(), m_NodeRadii.data(), m_BroadHits.data(),
+                                 candidateCount);
 
-        if (inDamageZone) {
-            node->TakeDamage(damage);
+        for (size_t i = 0; i < candidateCount; ++i) {
+            if (!m_BroadHits[i] || (m_GroupsHit[i] & groupBit)) {
+                continue;
+            }
+
+            Node* node = m_Candidates[i];
+            if (node->GetState() != NodeState::Active) {
+                continue;
+            }
 
-            float healthCost = 0.5f;
-            if (node->GetShape() == NodeShape::Boss) {
-                healthCost *= 8.0f;
+            const NodeArchetype& archetype = NodeArchetypes::Get(node->GetShape());
+            ZoneGeometry::NodeOutline outline{m_NodeXs[i], m_NodeYs[i], m_NodeRadii[i], archetype.outlineSides,
+                                              node->GetRotation() + archetype.outlinePhase};
+            if (!ZoneGeometry::Intersects(frame, outline)) {
+                continue;
             }
 
-            float scaledHealthCost = healthCost * (1.0f + (currentLevel - 1) * 0.20f);
+            m_GroupsHit[i] |= groupBit;
+            node->TakeDamage(zone.damage);
+
+            float scaledHealthCost = archetype.healthCost * healthCostScale * zone.healthCostScale;
 
             if (onNodeDamaged) {
-                onNodeDamaged(node, scaledHealthCost);
+                onNodeDamaged(node, scaledHealthCost, z);
             }
         }
     }
-}
\ No newline at end of file
+}
+
+void DamageZoneService::SaveCheckpoint(DamageZoneCheckpoint& checkpoint) const {
+    checkpoint.damageTimer = m_DamageTimer;
+}
+
+void DamageZoneService::LoadCheckpoint(const DamageZoneCheckpoint& checkpoint) {
+    m_DamageTimer = checkpoint.damageTimer;
+}
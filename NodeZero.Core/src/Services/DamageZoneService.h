@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
+#include "Config/LevelTable.h"
+#include "Math/ZoneGeometry.h"
 #include "Services/IDamageZoneService.h"
+#include "Types/Checkpoint.h"
 
 class Node;
 
@@ -11,6 +15,15 @@ class DamageZoneService : public IDamageZoneService {
    private:
     float m_DamageTimer;
     float m_DamageInterval;
+    const LevelTable* m_LevelTable;
+    std::vector<DamageZone> m_SingleZone;
+    std::vector<ZoneGeometry::ZoneFrame> m_ZoneFrames;
+    std::vector<Node*> m_Candidates;
+    std::vector<float> m_NodeXs;
+    std::vector<float> m_NodeYs;
+    std::vector<float> m_NodeRadii;
+    std::vector<uint8_t> m_BroadHits;
+    std::vector<uint32_t> m_GroupsHit;
 
    public:
     DamageZoneService();
@@ -20,6 +33,11 @@ class DamageZoneService : public IDamageZoneService {
     void ResetTimer() override;
     bool ShouldDealDamage() const override;
 
+    void SetLevelTable(const LevelTable* levelTable);
+
+    void SaveCheckpoint(DamageZoneCheckpoint& checkpoint) const;
+    void LoadCheckpoint(const DamageZoneCheckpoint& checkpoint);
+
     void ProcessDamageZone(
         float centerX,
         float centerY,
@@ -28,4 +46,10 @@ class DamageZoneService : public IDamageZoneService {
         int currentLevel,
         const std::vector<Node*>& nodes,
         std::function<void(Node*, float)> onNodeDamaged) override;
+
+    void ProcessDamageZones(
+        const std::vector<DamageZone>& zones,
+        int currentLevel,
+        const std::vector<Node*>& nodes,
+        std::function<void(Node*, float, size_t)> onNodeDamaged) override;
 };
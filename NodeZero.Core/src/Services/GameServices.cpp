@@ -0,0 +1,34 @@
+#include "Services/GameServices.h"
+
+#include <chrono>
+
+#include "CheckpointService.h"
+#include "ClockService.h"
+#include "InMemoryCheckpointService.h"
+#include "InMemoryRunHistoryService.h"
+#include "InMemorySaveService.h"
+#include "ManualClockService.h"
+#include "RandomService.h"
+#include "RunHistoryService.h"
+#include "SaveService.h"
+
+GameServices GameServices::CreateDefault() {
+    GameServices services;
+    services.saveService = std::make_unique<SaveService>();
+    services.randomService = std::make_unique<RandomService>(
+        static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count()));
+    services.clockService = std::make_unique<ClockService>();
+    services.checkpointService = std::make_unique<CheckpointService>();
+    services.runHistoryService = std::make_unique<RunHistoryService>();
+    return services;
+}
+
+GameServices GameServices::CreateInMemory(uint64_t seed, const SaveData& initialData) {
+    GameServices services;
+    services.saveService = std::make_unique<InMemorySaveService>(initialData);
+    services.randomService = std::make_unique<RandomService>(seed);
+    services.clockService = std::make_unique<ManualClockService>();
+    services.checkpointService = std::make_unique<InMemoryCheckpointService>();
+    services.runHistoryService = std::make_unique<InMemoryRunHistoryService>();
+    return services;
+}
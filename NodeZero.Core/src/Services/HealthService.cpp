@@ -9,7 +9,9 @@ HealthService::HealthService()
       m_HealthDepletionRate(0.1f),
       m_HealthDepletionInterval(0.3f),
       m_HealthTimer(0.0f),
-      m_CurrentLevel(1) {
+      m_CurrentLevel(1),
+      m_LevelTable(&LevelTable::Default()),
+      m_DepletionScale(m_LevelTable->Get(1).healthDepletionScale) {
 }
 
 void HealthService::Initialize(float maxHealth, float regenRate) {
@@ -46,6 +48,12 @@ void HealthService::SetRegenRate(float regenRate) {
 
 void HealthService::SetCurrentLevel(int level) {
     m_CurrentLevel = level;
+    m_DepletionScale = m_LevelTable->Get(level).healthDepletionScale;
+}
+
+void HealthService::SetLevelTable(const LevelTable* levelTable) {
+    m_LevelTable = levelTable ? levelTable : &LevelTable::Default();
+    m_DepletionScale = m_LevelTable->Get(m_CurrentLevel).healthDepletionScale;
 }
 
 void HealthService::RestoreToMax() {
@@ -76,7 +84,7 @@ void HealthService::ApplyRegeneration(float deltaTime) {
 void HealthService::ApplyDepletion(float deltaTime) {
     m_HealthTimer += deltaTime;
     if (m_HealthTimer >= m_HealthDepletionInterval) {
-        float scaledDepletionRate = m_HealthDepletionRate * (1.0f + (m_CurrentLevel - 1) * 0.20f);
+        float scaledDepletionRate = m_HealthDepletionRate * m_DepletionScale;
         m_CurrentHealth -= scaledDepletionRate;
         m_HealthTimer = 0.0f;
 
@@ -85,3 +93,17 @@ void HealthService::ApplyDepletion(float deltaTime) {
         }
     }
 }
+
+void HealthService::SaveCheckpoint(HealthCheckpoint& checkpoint) const {
+    checkpoint.maxHealth = m_MaxHealth;
+    checkpoint.currentHealth = m_CurrentHealth;
+    checkpoint.regenRate = m_RegenRate;
+    checkpoint.healthTimer = m_HealthTimer;
+}
+
+void HealthService::LoadCheckpoint(const HealthCheckpoint& checkpoint) {
+    m_MaxHealth = checkpoint.maxHealth;
+    m_CurrentHealth = checkpoint.currentHealth;
+    m_RegenRate = checkpoint.regenRate;
+    m_HealthTimer = checkpoint.healthTimer;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Config/LevelTable.h"
 #include "Services/IHealthService.h"
+#include "Types/Checkpoint.h"
 
 class HealthService : public IHealthService {
    private:
@@ -11,6 +13,8 @@ class HealthService : public IHealthService {
     float m_HealthDepletionInterval;
     float m_HealthTimer;
     int m_CurrentLevel;
+    const LevelTable* m_LevelTable;
+    float m_DepletionScale;
 
    public:
     HealthService();
@@ -24,12 +28,16 @@ class HealthService : public IHealthService {
     void SetMaxHealth(float maxHealth);
     void SetRegenRate(float regenRate);
     void SetCurrentLevel(int level);
+    void SetLevelTable(const LevelTable* levelTable);
     void RestoreToMax() override;
 
     float GetCurrent() const override;
     float GetMax() const override;
     bool IsZero() const override;
 
+    void SaveCheckpoint(HealthCheckpoint& checkpoint) const;
+    void LoadCheckpoint(const HealthCheckpoint& checkpoint);
+
    private:
     void ApplyRegeneration(float deltaTime);
     void ApplyDepletion(float deltaTime);
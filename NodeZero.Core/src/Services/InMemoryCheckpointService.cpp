@@ -0,0 +1,23 @@
+#include "InMemoryCheckpointService.h"
+
+#include "Storage/CheckpointFormat.h"
+
+void InMemoryCheckpointService::Submit(Checkpoint& checkpoint) {
+    CheckpointFormat::Write(checkpoint, m_Bytes);
+}
+
+bool InMemoryCheckpointService::Load(Checkpoint& checkpoint) {
+    return CheckpointFormat::Read(m_Bytes.data(), m_Bytes.size(), checkpoint);
+}
+
+bool InMemoryCheckpointService::HasCheckpoint() const {
+    return !m_Bytes.empty();
+}
+
+void InMemoryCheckpointService::Discard() {
+    m_Bytes.clear();
+}
+
+const std::vector<uint8_t>& InMemoryCheckpointService::GetBytes() const {
+    return m_Bytes;
+}
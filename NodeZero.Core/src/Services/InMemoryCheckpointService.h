@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Services/ICheckpointService.h"
+
+// Holds the latest checkpoint in the file format, without touching the disk.
+class InMemoryCheckpointService : public ICheckpointService {
+   private:
+    std::vector<uint8_t> m_Bytes;
+
+   public:
+    InMemoryCheckpointService() = default;
+    ~InMemoryCheckpointService() override = default;
+
+    void Submit(Checkpoint& checkpoint) override;
+    bool Load(Checkpoint& checkpoint) override;
+    bool HasCheckpoint() const override;
+    void Discard() override;
+
+    const std::vector<uint8_t>& GetBytes() const;
+};
@@ -0,0 +1,5 @@
+#include "InMemoryRunHistoryService.h"
+
+InMemoryRunHistoryService::InMemoryRunHistoryService()
+    : RunHistoryService(Backing::Memory, "") {
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "RunHistoryService.h"
+
+// The run history in the file layout, held in a plain buffer. For tests and the simulator.
+class InMemoryRunHistoryService : public RunHistoryService {
+   public:
+    InMemoryRunHistoryService();
+    ~InMemoryRunHistoryService() override = default;
+};
@@ -0,0 +1,25 @@
+#include "InMemorySaveService.h"
+
+InMemorySaveService::InMemorySaveService(const SaveData& initialData)
+    : m_CurrentData(initialData) {
+}
+
+SaveData InMemorySaveService::LoadProgress() {
+    return m_CurrentData;
+}
+
+void InMemorySaveService::SaveProgress(const SaveData& data) {
+    m_CurrentData = data;
+}
+
+int InMemorySaveService::GetPoints() const {
+    return m_CurrentData.points;
+}
+
+int InMemorySaveService::GetHighPoints() const {
+    return m_CurrentData.highPoints;
+}
+
+SaveData InMemorySaveService::GetCurrentData() const {
+    return m_CurrentData;
+}
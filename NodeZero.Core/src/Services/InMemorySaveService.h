@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Services/ISaveService.h"
+#include "Types/SaveData.h"
+
+class InMemorySaveService : public ISaveService {
+   private:
+    SaveData m_CurrentData;
+
+   public:
+    explicit InMemorySaveService(const SaveData& initialData = SaveData{});
+    ~InMemorySaveService() override = default;
+
+    SaveData LoadProgress() override;
+    void SaveProgress(const SaveData& data) override;
+
+    int GetPoints() const override;
+    int GetHighPoints() const override;
+    SaveData GetCurrentData() const override;
+};
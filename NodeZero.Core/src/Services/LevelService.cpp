@@ -39,6 +39,10 @@ void LevelService::IncrementNodesDestroyed() {
     m_NodesDestroyedThisLevel++;
 }
 
+void LevelService::AddNodesDestroyed(int count) {
+    m_NodesDestroyedThisLevel += count;
+}
+
 void LevelService::SetBossActive(bool active) {
     m_BossActive = active;
 }
@@ -89,3 +93,21 @@ void LevelService::Update(float deltaTime) {
 void LevelService::Reset() {
     Reset(1);
 }
+
+void LevelService::SaveCheckpoint(LevelCheckpoint& checkpoint) const {
+    checkpoint.level = m_CurrentLevel;
+    checkpoint.nodesDestroyedThisLevel = m_NodesDestroyedThisLevel;
+    checkpoint.levelTimer = m_LevelTimer;
+    checkpoint.levelDuration = m_LevelDuration;
+    checkpoint.bossActive = m_BossActive ? 1 : 0;
+    checkpoint.levelCompleted = m_LevelCompleted ? 1 : 0;
+}
+
+void LevelService::LoadCheckpoint(const LevelCheckpoint& checkpoint) {
+    m_CurrentLevel = checkpoint.level < 1 ? 1 : checkpoint.level;
+    m_NodesDestroyedThisLevel = checkpoint.nodesDestroyedThisLevel;
+    m_LevelTimer = checkpoint.levelTimer;
+    m_LevelDuration = checkpoint.levelDuration;
+    m_BossActive = checkpoint.bossActive != 0;
+    m_LevelCompleted = checkpoint.levelCompleted != 0;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Services/ILevelService.h"
+#include "Types/Checkpoint.h"
 
 class LevelService : public ILevelService {
    private:
@@ -22,6 +23,7 @@ class LevelService : public ILevelService {
     void Reset(int level);
 
     void IncrementNodesDestroyed() override;
+    void AddNodesDestroyed(int count);
     void SetBossActive(bool active);
     void SetLevelCompleted(bool completed);
     void StartNextLevel() override;
@@ -32,4 +34,7 @@ class LevelService : public ILevelService {
     bool IsLevelCompleted() const override;
     bool ShouldSpawnBoss() const override;
     float GetProgressBarPercentage() const override;
+
+    void SaveCheckpoint(LevelCheckpoint& checkpoint) const;
+    void LoadCheckpoint(const LevelCheckpoint& checkpoint);
 };
@@ -0,0 +1,17 @@
+#include "ManualClockService.h"
+
+ManualClockService::ManualClockService()
+    : m_Time(0.0) {
+}
+
+void ManualClockService::Advance(double seconds) {
+    m_Time += seconds;
+}
+
+void ManualClockService::SetTime(double seconds) {
+    m_Time = seconds;
+}
+
+double ManualClockService::GetTime() const {
+    return m_Time;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Services/IClockService.h"
+
+class ManualClockService : public IClockService {
+   private:
+    double m_Time;
+
+   public:
+    ManualClockService();
+    ~ManualClockService() override = default;
+
+    void Advance(double seconds);
+    void SetTime(double seconds);
+
+    double GetTime() const override;
+};
@@ -5,53 +5,179 @@
 #include <cstdlib>
 
 #include "Config/GameConfig.h"
+#include "Math/FastMath.h"
+#include "Services/IRandomService.h"
 
 PickupService::PickupService()
     : m_NextPickupId(0),
       m_PickupPoints(0),
-      m_ScreenHeight(0.0f) {
+      m_ScreenHeight(0.0f),
+      m_RandomService(nullptr),
+      m_MergeThreshold(GameConfig::PICKUP_MERGE_THRESHOLD),
+      m_CollectCellSize(0.0f),
+      m_MaxPickupSize(0.0f),
+      m_CollectGridDirty(true) {
 }
 
 void PickupService::Initialize(float screenHeight) {
     m_ScreenHeight = screenHeight;
 }
 
+void PickupService::SetRandomService(IRandomService* randomService) {
+    m_RandomService = randomService;
+}
+
 void PickupService::Update(float deltaTime) {
     for (auto& pickup : m_Pickups) {
         pickup.remainingTime -= deltaTime;
     }
 
+    size_t count = m_Pickups.size();
     m_Pickups.erase(std::remove_if(m_Pickups.begin(), m_Pickups.end(),
                                    [](const PointPickup& pickup) {
                                        return pickup.remainingTime <= 0.0f;
                                    }),
                     m_Pickups.end());
+    if (m_Pickups.size() != count) {
+        m_CollectGridDirty = true;
+    }
+
+    if (m_Pickups.size() > m_MergeThreshold) {
+        ConsolidatePickups();
+    }
+}
+
+void PickupService::SetMergeThreshold(size_t threshold) {
+    m_MergeThreshold = threshold;
+}
+
+void PickupService::ConsolidatePickups() {
+    size_t count = m_Pickups.size();
+    m_MergeXs.resize(count);
+    m_MergeYs.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_MergeXs[i] = m_Pickups[i].position.x;
+        m_MergeYs[i] = m_Pickups[i].position.y;
+    }
+
+    float radius = m_ScreenHeight * 0.0075f * GameConfig::PICKUP_MERGE_RADIUS_SCALE;
+    float radiusSquared = radius * radius;
+    m_MergeGrid.Build(m_MergeXs.data(), m_MergeYs.data(), count, radius);
+
+    // -1: untouched, i: kept as a merge target, anything else: absorbed into that index
+    m_MergeTarget.assign(count, -1);
+    size_t absorbed = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (m_MergeTarget[i] != -1 || m_Pickups[i].GetAge() < GameConfig::PICKUP_MERGE_MIN_AGE) {
+            continue;
+        }
+
+        int target = static_cast<int>(i);
+        m_MergeTarget[i] = target;
+        PointPickup& merged = m_Pickups[i];
+
+        m_MergeGrid.QueryRadius(m_MergeXs[i], m_MergeYs[i], radius, [&](uint32_t j) {
+            if (m_MergeTarget[j] != -1) {
+                return;
+            }
+
+            const PointPickup& other = m_Pickups[j];
+            float dx = m_MergeXs[j] - m_MergeXs[i];
+            float dy = m_MergeYs[j] - m_MergeYs[i];
+            if (dx * dx + dy * dy > radiusSquared || other.GetAge() < GameConfig::PICKUP_MERGE_MIN_AGE) {
+                return;
+            }
+
+            m_MergeTarget[j] = target;
+            merged.points += other.points;
+            if (other.remainingTime > merged.remainingTime) {
+                merged.remainingTime = other.remainingTime;
+                merged.lifetime = other.lifetime;
+            }
+            absorbed++;
+        });
+    }
+
+    if (absorbed == 0) {
+        return;
+    }
+
+    size_t writeIndex = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (m_MergeTarget[i] == -1 || m_MergeTarget[i] == static_cast<int>(i)) {
+            m_Pickups[writeIndex++] = m_Pickups[i];
+        }
+    }
+    m_Pickups.resize(writeIndex);
+    m_CollectGridDirty = true;
 }
 
 void PickupService::Reset() {
     m_Pickups.clear();
+    m_CollectGridDirty = true;
     m_NextPickupId = 0;
     m_PickupPoints = 0;
 }
 
 void PickupService::SpawnPointPickups(const Position& origin) {
-    int pickupCount = 5 + (std::rand() % 6);
+    m_Bursts.assign(1, PickupBurst{origin, RollBurstCount(), 1});
+    SpawnPickupBursts(m_Bursts);
+}
 
-    for (int i = 0; i < pickupCount; ++i) {
-        float angle = RandomRange(0.0f, 6.28318530718f);
-        float radius = RandomRange(m_ScreenHeight * 0.0125f, m_ScreenHeight * 0.05f);
+void PickupService::SpawnPointPickups(const std::vector<Position>& origins) {
+    m_Bursts.clear();
+    for (const Position& origin : origins) {
+        m_Bursts.push_back(PickupBurst{origin, RollBurstCount(), 1});
+    }
+    SpawnPickupBursts(m_Bursts);
+}
 
-        PointPickup pickup{};
-        pickup.id = m_NextPickupId++;
-        pickup.position.x = origin.x + std::cos(angle) * radius;
-        pickup.position.y = origin.y + std::sin(angle) * radius;
-        pickup.spawnOrigin = origin;
-        pickup.size = m_ScreenHeight * 0.0075f;
-        pickup.lifetime = GameConfig::PICKUP_LIFETIME;
-        pickup.remainingTime = GameConfig::PICKUP_LIFETIME;
-        pickup.points = 1;
+void PickupService::SpawnPickupBursts(const std::vector<PickupBurst>& bursts) {
+    size_t total = 0;
+    for (const PickupBurst& burst : bursts) {
+        total += static_cast<size_t>(std::max(0, burst.count));
+    }
 
-        m_Pickups.push_back(pickup);
+    if (total == 0) {
+        return;
+    }
+
+    m_Angles.resize(total);
+    m_Radii.resize(total);
+    m_Sines.resize(total);
+    m_Cosines.resize(total);
+
+    // One draw from the shared RNG seeds a local stream for the whole batch.
+    uint32_t state = NextStreamSeed();
+    float minRadius = m_ScreenHeight * 0.0125f;
+    float radiusSpan = m_ScreenHeight * 0.05f - minRadius;
+    for (size_t i = 0; i < total; ++i) {
+        m_Angles[i] = FastMath::NextUnit(state) * FastMath::TWO_PI;
+        m_Radii[i] = minRadius + FastMath::NextUnit(state) * radiusSpan;
+    }
+
+    FastMath::SinCos(m_Angles.data(), m_Sines.data(), m_Cosines.data(), total);
+
+    size_t first = m_Pickups.size();
+    m_Pickups.resize(first + total);
+    m_CollectGridDirty = true;
+    PointPickup* out = m_Pickups.data() + first;
+    float pickupSize = m_ScreenHeight * 0.0075f;
+    size_t index = 0;
+
+    for (const PickupBurst& burst : bursts) {
+        for (int k = 0; k < burst.count; ++k, ++index) {
+            PointPickup& pickup = out[index];
+            pickup.id = m_NextPickupId++;
+            pickup.position.x = burst.origin.x + m_Cosines[index] * m_Radii[index];
+            pickup.position.y = burst.origin.y + m_Sines[index] * m_Radii[index];
+            pickup.spawnOrigin = burst.origin;
+            pickup.size = pickupSize;
+            pickup.lifetime = GameConfig::PICKUP_LIFETIME;
+            pickup.remainingTime = GameConfig::PICKUP_LIFETIME;
+            pickup.points = burst.pointValue;
+        }
     }
 }
 
@@ -72,31 +198,13 @@ bool PickupService::CollectPickup(int pickupId) {
 
     m_PickupPoints += it->points;
     m_Pickups.erase(it);
+    m_CollectGridDirty = true;
     return true;
 }
 
 std::vector<PointPickup> PickupService::ProcessPickupCollection(float centerX, float centerY, float zoneSize) {
-    float collectRectX = centerX - zoneSize / 2.0f;
-    float collectRectY = centerY - zoneSize / 2.0f;
-
     std::vector<PointPickup> collectedPickups;
-
-    for (const PointPickup& pickup : m_Pickups) {
-        if (pickup.GetAge() < GameConfig::PICKUP_COLLECT_DELAY) {
-            continue;
-        }
-
-        bool intersects = !(pickup.position.x + pickup.size < collectRectX ||
-                            pickup.position.x - pickup.size > collectRectX + zoneSize ||
-                            pickup.position.y + pickup.size < collectRectY ||
-                            pickup.position.y - pickup.size > collectRectY + zoneSize);
-
-        if (intersects) {
-            collectedPickups.push_back(pickup);
-            CollectPickup(pickup.id);
-        }
-    }
-
+    ProcessPickupCollection(centerX, centerY, centerX, centerY, zoneSize, collectedPickups);
     return collectedPickups;
 }
 
@@ -108,53 +216,152 @@ int PickupService::GetPickupPoints() const {
     return m_PickupPoints;
 }
 
-float PickupService::RandomRange(float minValue, float maxValue) const {
-    float t = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
-    return minValue + (maxValue - minValue) * t;
+uint32_t PickupService::NextStreamSeed() const {
+    uint32_t seed = static_cast<uint32_t>(RandomInt(0x7FFFFFFF));
+    seed = seed * 2654435761u ^ 0x9E3779B9u;
+    return seed != 0 ? seed : 1u;
 }
-void PickupService::SpawnPointPickups(const Position& origin, int count, int pointValue) {
-    for (int i = 0; i < count; ++i) {
-        float angle = RandomRange(0.0f, 6.28318530718f);
-        float radius = RandomRange(m_ScreenHeight * 0.0125f, m_ScreenHeight * 0.05f);
 
-        PointPickup pickup{};
-        pickup.id = m_NextPickupId++;
-        pickup.position.x = origin.x + std::cos(angle) * radius;
-        pickup.position.y = origin.y + std::sin(angle) * radius;
-        pickup.spawnOrigin = origin;
-        pickup.size = m_ScreenHeight * 0.0075f;
-        pickup.lifetime = GameConfig::PICKUP_LIFETIME;
-        pickup.remainingTime = GameConfig::PICKUP_LIFETIME;
-        pickup.points = pointValue;
+int PickupService::RollBurstCount() const {
+    return 5 + RandomInt(6);
+}
 
-        m_Pickups.push_back(pickup);
+int PickupService::RandomInt(int maxExclusive) const {
+    if (m_RandomService) {
+        return m_RandomService->NextInt(maxExclusive);
     }
+    return std::rand() % maxExclusive;
+}
+
+void PickupService::SpawnPointPickups(const Position& origin, int count, int pointValue) {
+    m_Bursts.assign(1, PickupBurst{origin, count, pointValue});
+    SpawnPickupBursts(m_Bursts);
 }
 
 void PickupService::ProcessPickupCollection(float mouseX, float mouseY, float damageZoneSize,
                                            std::vector<PointPickup>& collectedPickups) {
+    ProcessPickupCollection(mouseX, mouseY, mouseX, mouseY, damageZoneSize, collectedPickups);
+}
+
+// Slab test of the segment p + t * d, t in [0, 1], against an axis-aligned box.
+static bool SegmentHitsBox(float px, float py, float dx, float dy, float minX, float minY, float maxX, float maxY) {
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+
+    const float start[2] = {px, py};
+    const float delta[2] = {dx, dy};
+    const float low[2] = {minX, minY};
+    const float high[2] = {maxX, maxY};
+
+    for (int axis = 0; axis < 2; ++axis) {
+        if (std::abs(delta[axis]) < 1e-6f) {
+            if (start[axis] < low[axis] || start[axis] > high[axis]) {
+                return false;
+            }
+            continue;
+        }
+
+        float inverse = 1.0f / delta[axis];
+        float t1 = (low[axis] - start[axis]) * inverse;
+        float t2 = (high[axis] - start[axis]) * inverse;
+        if (t1 > t2) {
+            std::swap(t1, t2);
+        }
+
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void PickupService::RebuildCollectGrid(float cellSize) {
+    size_t count = m_Pickups.size();
+    m_MaxPickupSize = 0.0f;
+    m_CollectXs.resize(count);
+    m_CollectYs.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_CollectXs[i] = m_Pickups[i].position.x;
+        m_CollectYs[i] = m_Pickups[i].position.y;
+        m_MaxPickupSize = std::max(m_MaxPickupSize, m_Pickups[i].size);
+    }
+
+    m_CollectGrid.Build(m_CollectXs.data(), m_CollectYs.data(), count, cellSize);
+    m_CollectCellSize = cellSize;
+    m_CollectGridDirty = false;
+}
+
+void PickupService::ProcessPickupCollection(float fromX, float fromY, float toX, float toY, float damageZoneSize,
+                                           std::vector<PointPickup>& collectedPickups) {
     collectedPickups.clear();
-    
-    float collectRectX = mouseX - damageZoneSize / 2.0f;
-    float collectRectY = mouseY - damageZoneSize / 2.0f;
 
-    for (const PointPickup& pickup : m_Pickups) {
+    if (m_Pickups.empty()) {
+        return;
+    }
+
+    if (m_CollectGridDirty || m_CollectCellSize != damageZoneSize) {
+        RebuildCollectGrid(damageZoneSize);
+    }
+
+    float halfZone = damageZoneSize / 2.0f;
+    float reach = halfZone + m_MaxPickupSize;
+
+    // A pickup is touched when the zone center's path crosses the pickup box grown by the half zone
+    float sweepX = toX - fromX;
+    float sweepY = toY - fromY;
+    m_CollectedIndices.clear();
+
+    m_CollectGrid.QueryRect(std::min(fromX, toX) - reach, std::min(fromY, toY) - reach,
+                            std::max(fromX, toX) + reach, std::max(fromY, toY) + reach, [&](uint32_t index) {
+        const PointPickup& pickup = m_Pickups[index];
         if (pickup.GetAge() < GameConfig::PICKUP_COLLECT_DELAY) {
-            continue;
+            return;
+        }
+
+        float extent = halfZone + pickup.size;
+        if (SegmentHitsBox(fromX, fromY, sweepX, sweepY, pickup.position.x - extent, pickup.position.y - extent,
+                           pickup.position.x + extent, pickup.position.y + extent)) {
+            m_CollectedIndices.push_back(index);
         }
+    });
 
-        bool intersects = !(pickup.position.x + pickup.size < collectRectX ||
-                            pickup.position.x - pickup.size > collectRectX + damageZoneSize ||
-                            pickup.position.y + pickup.size < collectRectY ||
-                            pickup.position.y - pickup.size > collectRectY + damageZoneSize);
+    if (m_CollectedIndices.empty()) {
+        return;
+    }
 
-        if (intersects) {
-            collectedPickups.push_back(pickup);
-            CollectPickup(pickup.id);
+    // Survivors keep their order, so compact from the first collected index onward
+    std::sort(m_CollectedIndices.begin(), m_CollectedIndices.end());
+    size_t writeIndex = m_CollectedIndices.front();
+    size_t next = 0;
+    for (size_t i = writeIndex; i < m_Pickups.size(); ++i) {
+        if (next < m_CollectedIndices.size() && m_CollectedIndices[next] == i) {
+            m_PickupPoints += m_Pickups[i].points;
+            collectedPickups.push_back(m_Pickups[i]);
+            next++;
+        } else {
+            m_Pickups[writeIndex++] = m_Pickups[i];
         }
     }
+    m_Pickups.resize(writeIndex);
+    m_CollectGridDirty = true;
 }
 
 void PickupService::Clear() {
     Reset();
 }
+
+void PickupService::SaveCheckpoint(PickupCheckpoint& counters, std::vector<PointPickup>& pickups) const {
+    counters.nextPickupId = m_NextPickupId;
+    counters.pickupPoints = m_PickupPoints;
+    pickups.assign(m_Pickups.begin(), m_Pickups.end());
+}
+
+void PickupService::LoadCheckpoint(const PickupCheckpoint& counters, const std::vector<PointPickup>& pickups) {
+    m_NextPickupId = counters.nextPickupId;
+    m_PickupPoints = counters.pickupPoints;
+    m_Pickups.assign(pickups.begin(), pickups.end());
+    m_CollectGridDirty = true;
+}
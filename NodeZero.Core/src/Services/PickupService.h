@@ -1,37 +1,86 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "Services/IPickupService.h"
+#include "Spatial/SpatialGrid.h"
+#include "Types/Checkpoint.h"
+#include "Types/PickupBurst.h"
 #include "Types/PointPickup.h"
 #include "Types/Position.h"
 
+class IRandomService;
+
 class PickupService : public IPickupService {
    private:
     std::vector<PointPickup> m_Pickups;
     int m_NextPickupId;
     int m_PickupPoints;
     float m_ScreenHeight;
+    IRandomService* m_RandomService;
+
+    // Scratch arrays for the bulk burst generator, reused between calls.
+    std::vector<PickupBurst> m_Bursts;
+    std::vector<float> m_Angles;
+    std::vector<float> m_Radii;
+    std::vector<float> m_Sines;
+    std::vector<float> m_Cosines;
+
+    // Level-of-detail merging of dense clusters.
+    size_t m_MergeThreshold;
+    SpatialGrid m_MergeGrid;
+    std::vector<float> m_MergeXs;
+    std::vector<float> m_MergeYs;
+    std::vector<int> m_MergeTarget;
+
+    // Index over pickup positions for swept collection. Pickups never move once spawned,
+    // so it is rebuilt only after the set changes or the damage zone is resized.
+    SpatialGrid m_CollectGrid;
+    std::vector<float> m_CollectXs;
+    std::vector<float> m_CollectYs;
+    std::vector<uint32_t> m_CollectedIndices;
+    float m_CollectCellSize;
+    float m_MaxPickupSize;
+    bool m_CollectGridDirty;
 
    public:
     PickupService();
     ~PickupService() override = default;
 
     void Initialize(float screenHeight);
+    void SetRandomService(IRandomService* randomService);
     void Update(float deltaTime) override;
     void Clear() override;
     void Reset();
 
     void SpawnPointPickups(const Position& origin, int count, int pointValue) override;
     void SpawnPointPickups(const Position& origin);
+    // Rewards for a whole batch of kills with a single reservation.
+    void SpawnPointPickups(const std::vector<Position>& origins);
+    void SpawnPickupBursts(const std::vector<PickupBurst>& bursts);
+
+    // Once more than threshold pickups are live, Update folds settled pickups that
+    // sit within a few pickup sizes of each other into one carrying the summed points.
+    void SetMergeThreshold(size_t threshold);
+    void ConsolidatePickups();
     bool CollectPickup(int pickupId) override;
     std::vector<PointPickup> ProcessPickupCollection(float centerX, float centerY, float zoneSize);
     void ProcessPickupCollection(float mouseX, float mouseY, float damageZoneSize,
                                  std::vector<PointPickup>& collectedPickups) override;
+    void ProcessPickupCollection(float fromX, float fromY, float toX, float toY, float damageZoneSize,
+                                 std::vector<PointPickup>& collectedPickups) override;
 
     const std::vector<PointPickup>& GetPickups() const override;
     int GetPickupPoints() const override;
 
+    // Pickups are saved with the checkpoint's records; the counters go in PickupCheckpoint.
+    void SaveCheckpoint(PickupCheckpoint& counters, std::vector<PointPickup>& pickups) const;
+    void LoadCheckpoint(const PickupCheckpoint& counters, const std::vector<PointPickup>& pickups);
+
    private:
-    float RandomRange(float minValue, float maxValue) const;
+    int RandomInt(int maxExclusive) const;
+    uint32_t NextStreamSeed() const;
+    int RollBurstCount() const;
+    void RebuildCollectGrid(float cellSize);
 };
@@ -0,0 +1,204 @@
+#include "ProjectileService.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Config/GameConfig.h"
+#include "Math/FastMath.h"
+
+namespace {
+
+constexpr float DEG_TO_RAD = FastMath::PI / 180.0f;
+
+// Projectiles this far past the screen edge are released early.
+constexpr float CULL_MARGIN = 50.0f;
+
+void Integrate(float* __restrict xs, float* __restrict ys, const float* __restrict velocityXs,
+               const float* __restrict velocityYs, size_t count, float deltaTime) {
+    for (size_t i = 0; i < count; ++i) {
+        xs[i] += velocityXs[i] * deltaTime;
+        ys[i] += velocityYs[i] * deltaTime;
+    }
+}
+
+}  // namespace
+
+ProjectileService::ProjectileService()
+    : m_Xs(GameConfig::PROJECTILE_CAPACITY, 0.0f),
+      m_Ys(GameConfig::PROJECTILE_CAPACITY, 0.0f),
+      m_VelocityXs(GameConfig::PROJECTILE_CAPACITY, 0.0f),
+      m_VelocityYs(GameConfig::PROJECTILE_CAPACITY, 0.0f),
+      m_Alive(GameConfig::PROJECTILE_CAPACITY, 0),
+      m_Generations(GameConfig::PROJECTILE_CAPACITY, 0),
+      m_HighWater(0),
+      m_ActiveCount(0),
+      m_Wheel(GameConfig::PROJECTILE_WHEEL_SLOTS),
+      m_WheelTick(0),
+      m_WheelAccumulator(0.0f),
+      m_ScreenWidth(0.0f),
+      m_ScreenHeight(0.0f),
+      m_Radius(0.0f) {
+    m_FreeSlots.reserve(GameConfig::PROJECTILE_CAPACITY);
+}
+
+void ProjectileService::Initialize(float screenWidth, float screenHeight) {
+    m_ScreenWidth = screenWidth;
+    m_ScreenHeight = screenHeight;
+    m_Radius = screenHeight * GameConfig::PROJECTILE_RADIUS_SCALE;
+}
+
+bool ProjectileService::Fire(float x, float y, float velocityX, float velocityY, float lifetime) {
+    uint32_t slot;
+    if (!m_FreeSlots.empty()) {
+        slot = m_FreeSlots.back();
+        m_FreeSlots.pop_back();
+    } else if (m_HighWater < m_Xs.size()) {
+        slot = static_cast<uint32_t>(m_HighWater++);
+    } else {
+        return false;
+    }
+
+    m_Xs[slot] = x;
+    m_Ys[slot] = y;
+    m_VelocityXs[slot] = velocityX;
+    m_VelocityYs[slot] = velocityY;
+    m_Alive[slot] = 1;
+    m_ActiveCount++;
+
+    // Lifetimes round up to whole ticks and are capped at one turn of the wheel
+    int ticks = static_cast<int>(std::ceil(lifetime / GameConfig::PROJECTILE_WHEEL_TICK));
+    ticks = std::max(1, std::min(ticks, GameConfig::PROJECTILE_WHEEL_SLOTS - 1));
+    size_t bucket = (m_WheelTick + ticks) % m_Wheel.size();
+    m_Wheel[bucket].push_back(WheelEntry{slot, m_Generations[slot]});
+    return true;
+}
+
+int ProjectileService::FireRadial(const Position& origin, int count, float speed, float startAngle) {
+    int fired = 0;
+    float step = 360.0f / std::max(1, count);
+    for (int i = 0; i < count; ++i) {
+        float sine;
+        float cosine;
+        FastMath::SinCos((startAngle + i * step) * DEG_TO_RAD, sine, cosine);
+        fired += Fire(origin.x, origin.y, cosine * speed, sine * speed, GameConfig::PROJECTILE_LIFETIME) ? 1 : 0;
+    }
+    return fired;
+}
+
+int ProjectileService::FireAimed(const Position& origin, const Position& target, int count, float spreadAngle,
+                                 float speed) {
+    float aim = std::atan2(target.y - origin.y, target.x - origin.x) / DEG_TO_RAD;
+    float step = count > 1 ? spreadAngle / (count - 1) : 0.0f;
+    float first = aim - step * (count - 1) * 0.5f;
+
+    int fired = 0;
+    for (int i = 0; i < count; ++i) {
+        float sine;
+        float cosine;
+        FastMath::SinCos((first + i * step) * DEG_TO_RAD, sine, cosine);
+        fired += Fire(origin.x, origin.y, cosine * speed, sine * speed, GameConfig::PROJECTILE_LIFETIME) ? 1 : 0;
+    }
+    return fired;
+}
+
+void ProjectileService::Update(float deltaTime) {
+    if (m_ActiveCount > 0) {
+        // Released slots have zero velocity, so the loop needs no liveness check
+        Integrate(m_Xs.data(), m_Ys.data(), m_VelocityXs.data(), m_VelocityYs.data(), m_HighWater, deltaTime);
+
+        float minX = -CULL_MARGIN;
+        float minY = -CULL_MARGIN;
+        float maxX = m_ScreenWidth + CULL_MARGIN;
+        float maxY = m_ScreenHeight + CULL_MARGIN;
+        for (size_t i = 0; i < m_HighWater; ++i) {
+            bool outside = (m_Xs[i] < minX) | (m_Xs[i] > maxX) | (m_Ys[i] < minY) | (m_Ys[i] > maxY);
+            if (m_Alive[i] & outside) {
+                Release(static_cast<uint32_t>(i));
+            }
+        }
+    } else {
+        // Pool drained: start filling from slot 0 again to keep the loops short
+        m_HighWater = 0;
+        m_FreeSlots.clear();
+    }
+
+    m_WheelAccumulator += deltaTime;
+    while (m_WheelAccumulator >= GameConfig::PROJECTILE_WHEEL_TICK) {
+        m_WheelAccumulator -= GameConfig::PROJECTILE_WHEEL_TICK;
+        AdvanceWheel();
+    }
+}
+
+void ProjectileService::AdvanceWheel() {
+    m_WheelTick++;
+    std::vector<WheelEntry>& bucket = m_Wheel[m_WheelTick % m_Wheel.size()];
+    for (const WheelEntry& entry : bucket) {
+        // Slots released early and reused since carry a newer generation
+        if (m_Alive[entry.slot] && m_Generations[entry.slot] == entry.generation) {
+            Release(entry.slot);
+        }
+    }
+    bucket.clear();
+}
+
+int ProjectileService::ProcessHits(float centerX, float centerY, float zoneSize) {
+    if (m_ActiveCount == 0) {
+        return 0;
+    }
+
+    float reach = zoneSize / 2.0f + m_Radius;
+    int hits = 0;
+    for (size_t i = 0; i < m_HighWater; ++i) {
+        bool inside = (std::fabs(m_Xs[i] - centerX) <= reach) & (std::fabs(m_Ys[i] - centerY) <= reach);
+        if (m_Alive[i] & inside) {
+            Release(static_cast<uint32_t>(i));
+            hits++;
+        }
+    }
+    return hits;
+}
+
+void ProjectileService::Release(uint32_t slot) {
+    m_Alive[slot] = 0;
+    m_VelocityXs[slot] = 0.0f;
+    m_VelocityYs[slot] = 0.0f;
+    m_Generations[slot]++;
+    m_FreeSlots.push_back(slot);
+    m_ActiveCount--;
+}
+
+void ProjectileService::Clear() {
+    std::fill(m_Alive.begin(), m_Alive.begin() + m_HighWater, 0);
+    std::fill(m_VelocityXs.begin(), m_VelocityXs.begin() + m_HighWater, 0.0f);
+    std::fill(m_VelocityYs.begin(), m_VelocityYs.begin() + m_HighWater, 0.0f);
+    for (std::vector<WheelEntry>& bucket : m_Wheel) {
+        bucket.clear();
+    }
+    m_FreeSlots.clear();
+    m_HighWater = 0;
+    m_ActiveCount = 0;
+}
+
+size_t ProjectileService::GetActiveCount() const {
+    return m_ActiveCount;
+}
+
+float ProjectileService::GetRadius() const {
+    return m_Radius;
+}
+
+size_t ProjectileService::GetSlotCount() const {
+    return m_HighWater;
+}
+
+const float* ProjectileService::GetXs() const {
+    return m_Xs.data();
+}
+
+const float* ProjectileService::GetYs() const {
+    return m_Ys.data();
+}
+
+const uint8_t* ProjectileService::GetAlive() const {
+    return m_Alive.data();
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Services/IProjectileService.h"
+#include "Types/Position.h"
+
+// Fixed-capacity pool of projectiles stored as columns. Slots are recycled through a free
+// list, so integration and hit tests are flat loops over [0, m_HighWater). Lifetimes live
+// on a timing wheel: each slot is filed under the tick it expires and a tick only visits
+// its own bucket.
+class ProjectileService : public IProjectileService {
+   private:
+    struct WheelEntry {
+        uint32_t slot;
+        uint32_t generation;
+    };
+
+    std::vector<float> m_Xs;
+    std::vector<float> m_Ys;
+    std::vector<float> m_VelocityXs;
+    std::vector<float> m_VelocityYs;
+    std::vector<uint8_t> m_Alive;
+    std::vector<uint32_t> m_Generations;
+    std::vector<uint32_t> m_FreeSlots;
+    size_t m_HighWater;
+    size_t m_ActiveCount;
+
+    std::vector<std::vector<WheelEntry>> m_Wheel;
+    uint64_t m_WheelTick;
+    float m_WheelAccumulator;
+
+    float m_ScreenWidth;
+    float m_ScreenHeight;
+    float m_Radius;
+
+   public:
+    ProjectileService();
+    ~ProjectileService() override = default;
+
+    void Initialize(float screenWidth, float screenHeight);
+
+    int FireRadial(const Position& origin, int count, float speed, float startAngle) override;
+    int FireAimed(const Position& origin, const Position& target, int count, float spreadAngle,
+                  float speed) override;
+    bool Fire(float x, float y, float velocityX, float velocityY, float lifetime);
+
+    void Update(float deltaTime) override;
+    int ProcessHits(float centerX, float centerY, float zoneSize) override;
+    void Clear() override;
+
+    size_t GetActiveCount() const override;
+    float GetRadius() const override;
+
+    size_t GetSlotCount() const override;
+    const float* GetXs() const override;
+    const float* GetYs() const override;
+    const uint8_t* GetAlive() const override;
+
+   private:
+    void Release(uint32_t slot);
+    void AdvanceWheel();
+};
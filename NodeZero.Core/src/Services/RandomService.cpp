@@ -0,0 +1,50 @@
+#include "RandomService.h"
+
+RandomService::RandomService(uint64_t seed)
+    : m_State(0) {
+    Seed(seed);
+}
+
+void RandomService::Seed(uint64_t seed) {
+    // splitmix64 scramble so that small or zero seeds still give a well mixed state
+    uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    m_State = z ^ (z >> 31);
+    if (m_State == 0) {
+        m_State = 0x9E3779B97F4A7C15ull;
+    }
+}
+
+uint64_t RandomService::NextBits() {
+    // xorshift64*
+    m_State ^= m_State >> 12;
+    m_State ^= m_State << 25;
+    m_State ^= m_State >> 27;
+    return m_State * 0x2545F4914F6CDD1Dull;
+}
+
+int RandomService::NextInt(int maxExclusive) {
+    if (maxExclusive <= 0) {
+        return 0;
+    }
+    return static_cast<int>((NextBits() >> 32) % static_cast<uint64_t>(maxExclusive));
+}
+
+float RandomService::NextFloat() {
+    // 24 random mantissa bits mapped to [0, 1]
+    return static_cast<float>(NextBits() >> 40) / static_cast<float>(0xFFFFFF);
+}
+
+float RandomService::Range(float minValue, float maxValue) {
+    return minValue + (maxValue - minValue) * NextFloat();
+}
+
+uint64_t RandomService::GetState() const {
+    return m_State;
+}
+
+void RandomService::SetState(uint64_t state) {
+    // xorshift never leaves zero
+    m_State = state != 0 ? state : 0x9E3779B97F4A7C15ull;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Services/IRandomService.h"
+
+class RandomService : public IRandomService {
+   private:
+    uint64_t m_State;
+
+   public:
+    explicit RandomService(uint64_t seed = 0);
+    ~RandomService() override = default;
+
+    void Seed(uint64_t seed) override;
+
+    int NextInt(int maxExclusive) override;
+    float NextFloat() override;
+    float Range(float minValue, float maxValue) override;
+    uint64_t GetState() const override;
+    void SetState(uint64_t state) override;
+
+   private:
+    uint64_t NextBits();
+};
@@ -0,0 +1,464 @@
+#include "RewindService.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "Config/GameConfig.h"
+
+namespace {
+constexpr size_t COUNT_WORDS = 3;
+constexpr size_t SCALAR_WORDS = 17;
+constexpr size_t HEADER_WORDS = COUNT_WORDS + SCALAR_WORDS;
+constexpr size_t NODE_COLUMNS = 8;
+constexpr size_t PICKUP_COLUMNS = 8;
+constexpr size_t PROJECTILE_COLUMNS = 2;
+// The header is coded as one column, ahead of the rest, so a decoder learns the counts first
+constexpr size_t COLUMN_COUNT = 1 + NODE_COLUMNS + PICKUP_COLUMNS + PROJECTILE_COLUMNS;
+
+struct ColumnLayout {
+    size_t nodes;
+    size_t pickups;
+    size_t projectiles;
+
+    void Get(size_t column, size_t& offset, size_t& length) const {
+        if (column == 0) {
+            offset = 0;
+            length = HEADER_WORDS;
+            return;
+        }
+        column -= 1;
+        offset = HEADER_WORDS;
+        if (column < NODE_COLUMNS) {
+            offset += column * nodes;
+            length = nodes;
+            return;
+        }
+        column -= NODE_COLUMNS;
+        offset += NODE_COLUMNS * nodes;
+        if (column < PICKUP_COLUMNS) {
+            offset += column * pickups;
+            length = pickups;
+            return;
+        }
+        column -= PICKUP_COLUMNS;
+        offset += PICKUP_COLUMNS * pickups + column * projectiles;
+        length = projectiles;
+    }
+};
+
+ColumnLayout LayoutOf(const std::vector<uint32_t>& words) {
+    return ColumnLayout{words[0], words[1], words[2]};
+}
+
+uint32_t FloatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void PushU64(std::vector<uint32_t>& words, uint64_t value) {
+    words.push_back(static_cast<uint32_t>(value));
+    words.push_back(static_cast<uint32_t>(value >> 32));
+}
+
+void PushDouble(std::vector<uint32_t>& words, double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    PushU64(words, bits);
+}
+
+uint64_t ReadU64(const std::vector<uint32_t>& words, size_t& index) {
+    uint64_t low = words[index++];
+    uint64_t high = words[index++];
+    return low | (high << 32);
+}
+
+double ReadDouble(const std::vector<uint32_t>& words, size_t& index) {
+    uint64_t bits = ReadU64(words, index);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Linear extrapolation from the two frames before, in the integer domain: a node moving
+// or turning at a steady rate leaves a zero residual. Without an older frame the previous
+// value is the guess; without either, zero.
+struct Predictor {
+    const uint32_t* base;
+    size_t baseLength;
+    const uint32_t* older;
+    size_t olderLength;
+
+    uint32_t At(size_t i) const {
+        if (i >= baseLength) {
+            return 0u;
+        }
+        return i < olderLength ? 2u * base[i] - older[i] : base[i];
+    }
+};
+
+Predictor PredictorFor(size_t column, const std::vector<uint32_t>* base, const std::vector<uint32_t>* older) {
+    Predictor predictor{nullptr, 0, nullptr, 0};
+    size_t offset;
+    if (base) {
+        LayoutOf(*base).Get(column, offset, predictor.baseLength);
+        predictor.base = base->data() + offset;
+    }
+    if (base && older) {
+        LayoutOf(*older).Get(column, offset, predictor.olderLength);
+        predictor.older = older->data() + offset;
+    }
+    return predictor;
+}
+
+// Residual from the prediction as a zigzag integer: small moves of a float, up or down,
+// only touch the low bytes of its bit pattern, where XOR would also flip every carried bit
+uint32_t ToResidual(uint32_t value, uint32_t prediction) {
+    uint32_t delta = value - prediction;
+    return (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+}
+
+uint32_t FromResidual(uint32_t zigzag, uint32_t prediction) {
+    uint32_t delta = (zigzag >> 1) ^ (0u - (zigzag & 1u));
+    return prediction + delta;
+}
+
+// 2-bit tag per word: 0, 1, 2 or 4 payload bytes
+void PutWord(uint8_t* tags, uint8_t*& payload, size_t index, uint32_t value) {
+    uint8_t tag = value == 0 ? 0 : value <= 0xFF ? 1 : value <= 0xFFFF ? 2 : 3;
+    tags[index / 4] |= static_cast<uint8_t>(tag << ((index % 4) * 2));
+
+    int bytes = tag == 3 ? 4 : tag;
+    for (int i = 0; i < bytes; ++i) {
+        *payload++ = static_cast<uint8_t>(value >> (i * 8));
+    }
+}
+
+uint32_t GetWord(const uint8_t* tags, const uint8_t*& payload, size_t index) {
+    int tag = (tags[index / 4] >> ((index % 4) * 2)) & 0x3;
+    int bytes = tag == 3 ? 4 : tag;
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; ++i) {
+        value |= static_cast<uint32_t>(*payload++) << (i * 8);
+    }
+    return value;
+}
+}  // namespace
+
+RewindService::RewindService()
+    : m_Enabled(false),
+      m_FirstSequence(0),
+      m_FramesSinceKeyframe(0),
+      m_Bytes(0),
+      m_FramesBack(0),
+      m_DecodedSequence(0),
+      m_HasDecoded(false) {
+}
+
+void RewindService::SetEnabled(bool enabled) {
+    m_Enabled = enabled;
+    if (!enabled) {
+        Clear();
+    }
+}
+
+bool RewindService::IsEnabled() const {
+    return m_Enabled;
+}
+
+void RewindService::Record(const WorldSnapshot& snapshot) {
+    if (!m_Enabled) {
+        return;
+    }
+
+    Flatten(snapshot, m_CurrentWords);
+
+    Frame frame;
+    if (!m_SpareFrames.empty()) {
+        frame = std::move(m_SpareFrames.back());
+        m_SpareFrames.pop_back();
+    }
+
+    bool keyframe = m_Frames.empty() ||
+                    m_FramesSinceKeyframe + 1 >= static_cast<size_t>(GameConfig::REWIND_KEYFRAME_INTERVAL);
+    // The frame right after a keyframe has only one frame of its group to predict from
+    const std::vector<uint32_t>* base = keyframe ? nullptr : &m_PreviousWords;
+    const std::vector<uint32_t>* older = !keyframe && m_FramesSinceKeyframe > 0 ? &m_OlderWords : nullptr;
+    Encode(m_CurrentWords, base, older, frame);
+    frame.simTime = snapshot.simTime;
+    frame.keyframe = keyframe;
+    m_FramesSinceKeyframe = keyframe ? 0 : m_FramesSinceKeyframe + 1;
+
+    m_Bytes += frame.tags.size() + frame.payload.size();
+    m_Frames.push_back(std::move(frame));
+    m_OlderWords.swap(m_PreviousWords);
+    m_PreviousWords.swap(m_CurrentWords);
+    m_FramesBack = 0;
+
+    Evict();
+}
+
+void RewindService::Evict() {
+    while (true) {
+        // Frames before the next keyframe depend on each other and go together
+        size_t next = 1;
+        while (next < m_Frames.size() && !m_Frames[next].keyframe) {
+            ++next;
+        }
+        if (next >= m_Frames.size()) {
+            break;
+        }
+
+        bool restCoversWindow = m_Frames.back().simTime - m_Frames[next].simTime >= GameConfig::REWIND_WINDOW;
+        bool overBudget = m_Bytes > static_cast<size_t>(GameConfig::REWIND_MAX_BYTES);
+        if (!restCoversWindow && !overBudget) {
+            break;
+        }
+
+        for (size_t i = 0; i < next; ++i) {
+            m_Bytes -= m_Frames.front().tags.size() + m_Frames.front().payload.size();
+            m_SpareFrames.push_back(std::move(m_Frames.front()));
+            m_Frames.pop_front();
+        }
+        m_FirstSequence += next;
+    }
+}
+
+void RewindService::Clear() {
+    m_FirstSequence += m_Frames.size();
+    for (Frame& frame : m_Frames) {
+        m_SpareFrames.push_back(std::move(frame));
+    }
+    m_Frames.clear();
+    m_FramesSinceKeyframe = 0;
+    m_Bytes = 0;
+    m_FramesBack = 0;
+    m_PreviousWords.clear();
+    m_OlderWords.clear();
+    m_HasDecoded = false;
+}
+
+size_t RewindService::GetFrameCount() const {
+    return m_Frames.size();
+}
+
+size_t RewindService::GetMemoryUsage() const {
+    return m_Bytes;
+}
+
+bool RewindService::StepBackward() {
+    if (m_FramesBack + 1 >= m_Frames.size()) {
+        return false;
+    }
+    m_FramesBack++;
+    return true;
+}
+
+bool RewindService::StepForward() {
+    if (m_FramesBack == 0) {
+        return false;
+    }
+    m_FramesBack--;
+    return true;
+}
+
+void RewindService::SeekNewest() {
+    m_FramesBack = 0;
+}
+
+size_t RewindService::GetFramesBack() const {
+    return m_FramesBack;
+}
+
+double RewindService::GetSecondsBack() const {
+    if (m_Frames.empty()) {
+        return 0.0;
+    }
+    return m_Frames.back().simTime - m_Frames[m_Frames.size() - 1 - m_FramesBack].simTime;
+}
+
+bool RewindService::ReadFrame(WorldSnapshot& snapshot) {
+    if (m_Frames.empty()) {
+        return false;
+    }
+
+    size_t target = m_Frames.size() - 1 - m_FramesBack;
+    size_t keyframe = target;
+    while (!m_Frames[keyframe].keyframe) {
+        --keyframe;
+    }
+
+    // Continue from the last decode when it lies between the keyframe and the target
+    size_t next;
+    if (m_HasDecoded && m_DecodedSequence >= m_FirstSequence + keyframe &&
+        m_DecodedSequence <= m_FirstSequence + target) {
+        next = static_cast<size_t>(m_DecodedSequence - m_FirstSequence) + 1;
+    } else {
+        Decode(m_Frames[keyframe], nullptr, nullptr, m_DecodedWords);
+        next = keyframe + 1;
+    }
+    for (; next <= target; ++next) {
+        const std::vector<uint32_t>* older = next - keyframe > 1 ? &m_DecodedOlderWords : nullptr;
+        Decode(m_Frames[next], &m_DecodedWords, older, m_ScratchWords);
+        m_DecodedOlderWords.swap(m_DecodedWords);
+        m_DecodedWords.swap(m_ScratchWords);
+    }
+    m_DecodedSequence = m_FirstSequence + target;
+    m_HasDecoded = true;
+
+    Unflatten(m_DecodedWords, snapshot);
+    return true;
+}
+
+void RewindService::Flatten(const WorldSnapshot& snapshot, std::vector<uint32_t>& words) {
+    size_t nodes = snapshot.nodes.size();
+    size_t pickups = snapshot.pickups.size();
+    size_t projectiles = snapshot.projectileXs.size();
+
+    words.clear();
+    words.reserve(HEADER_WORDS + NODE_COLUMNS * nodes + PICKUP_COLUMNS * pickups + PROJECTILE_COLUMNS * projectiles);
+
+    words.push_back(static_cast<uint32_t>(nodes));
+    words.push_back(static_cast<uint32_t>(pickups));
+    words.push_back(static_cast<uint32_t>(projectiles));
+
+    PushDouble(words, snapshot.simTime);
+    PushU64(words, snapshot.tick);
+    PushDouble(words, snapshot.tickMilliseconds);
+    words.push_back(FloatBits(snapshot.zoneCenter.x));
+    words.push_back(FloatBits(snapshot.zoneCenter.y));
+    words.push_back(FloatBits(snapshot.damageZoneSize));
+    words.push_back(FloatBits(snapshot.health));
+    words.push_back(FloatBits(snapshot.maxHealth));
+    words.push_back(static_cast<uint32_t>(snapshot.pickupPoints));
+    words.push_back(static_cast<uint32_t>(snapshot.level));
+    words.push_back(FloatBits(snapshot.levelProgress));
+    words.push_back(static_cast<uint32_t>(snapshot.mode));
+    words.push_back((snapshot.healthDepleted ? 1u : 0u) | (snapshot.levelCompleted ? 2u : 0u));
+    words.push_back(FloatBits(snapshot.projectileRadius));
+
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(static_cast<uint32_t>(node.id));
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(FloatBits(node.x));
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(FloatBits(node.y));
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(FloatBits(node.size));
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(FloatBits(node.hp));
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(FloatBits(node.maxHp));
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(FloatBits(node.rotation));
+    for (const NodeSnapshot& node : snapshot.nodes) words.push_back(static_cast<uint32_t>(node.shape));
+
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(FloatBits(pickup.position.x));
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(FloatBits(pickup.position.y));
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(FloatBits(pickup.spawnOrigin.x));
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(FloatBits(pickup.spawnOrigin.y));
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(FloatBits(pickup.size));
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(FloatBits(pickup.age));
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(FloatBits(pickup.lifeRatio));
+    for (const PickupSnapshot& pickup : snapshot.pickups) words.push_back(static_cast<uint32_t>(pickup.points));
+
+    for (float x : snapshot.projectileXs) words.push_back(FloatBits(x));
+    for (float y : snapshot.projectileYs) words.push_back(FloatBits(y));
+}
+
+void RewindService::Unflatten(const std::vector<uint32_t>& words, WorldSnapshot& snapshot) {
+    size_t nodes = words[0];
+    size_t pickups = words[1];
+    size_t projectiles = words[2];
+    size_t index = COUNT_WORDS;
+
+    snapshot.simTime = ReadDouble(words, index);
+    snapshot.tick = ReadU64(words, index);
+    snapshot.tickMilliseconds = ReadDouble(words, index);
+    snapshot.zoneCenter.x = BitsFloat(words[index++]);
+    snapshot.zoneCenter.y = BitsFloat(words[index++]);
+    snapshot.damageZoneSize = BitsFloat(words[index++]);
+    snapshot.health = BitsFloat(words[index++]);
+    snapshot.maxHealth = BitsFloat(words[index++]);
+    snapshot.pickupPoints = static_cast<int>(words[index++]);
+    snapshot.level = static_cast<int>(words[index++]);
+    snapshot.levelProgress = BitsFloat(words[index++]);
+    snapshot.mode = static_cast<GameMode>(words[index++]);
+    uint32_t flags = words[index++];
+    snapshot.healthDepleted = (flags & 1u) != 0;
+    snapshot.levelCompleted = (flags & 2u) != 0;
+    snapshot.projectileRadius = BitsFloat(words[index++]);
+
+    snapshot.nodes.resize(nodes);
+    for (NodeSnapshot& node : snapshot.nodes) node.id = static_cast<int>(words[index++]);
+    for (NodeSnapshot& node : snapshot.nodes) node.x = BitsFloat(words[index++]);
+    for (NodeSnapshot& node : snapshot.nodes) node.y = BitsFloat(words[index++]);
+    for (NodeSnapshot& node : snapshot.nodes) node.size = BitsFloat(words[index++]);
+    for (NodeSnapshot& node : snapshot.nodes) node.hp = BitsFloat(words[index++]);
+    for (NodeSnapshot& node : snapshot.nodes) node.maxHp = BitsFloat(words[index++]);
+    for (NodeSnapshot& node : snapshot.nodes) node.rotation = BitsFloat(words[index++]);
+    for (NodeSnapshot& node : snapshot.nodes) node.shape = static_cast<NodeShape>(words[index++]);
+
+    snapshot.pickups.resize(pickups);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.position.x = BitsFloat(words[index++]);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.position.y = BitsFloat(words[index++]);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.spawnOrigin.x = BitsFloat(words[index++]);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.spawnOrigin.y = BitsFloat(words[index++]);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.size = BitsFloat(words[index++]);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.age = BitsFloat(words[index++]);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.lifeRatio = BitsFloat(words[index++]);
+    for (PickupSnapshot& pickup : snapshot.pickups) pickup.points = static_cast<int>(words[index++]);
+
+    snapshot.projectileXs.resize(projectiles);
+    snapshot.projectileYs.resize(projectiles);
+    for (float& x : snapshot.projectileXs) x = BitsFloat(words[index++]);
+    for (float& y : snapshot.projectileYs) y = BitsFloat(words[index++]);
+
+    snapshot.collectedPickups.clear();
+    snapshot.events.clear();
+}
+
+void RewindService::Encode(const std::vector<uint32_t>& words, const std::vector<uint32_t>* base,
+                           const std::vector<uint32_t>* older, Frame& frame) {
+    // Sized for the worst case up front and trimmed after, so no word pays for a push_back
+    frame.wordCount = words.size();
+    frame.tags.assign((words.size() + 3) / 4, 0);
+    frame.payload.resize(words.size() * sizeof(uint32_t));
+    uint8_t* tags = frame.tags.data();
+    uint8_t* payload = frame.payload.data();
+
+    ColumnLayout layout = LayoutOf(words);
+    size_t written = 0;
+    for (size_t column = 0; column < COLUMN_COUNT; ++column) {
+        size_t offset, length;
+        layout.Get(column, offset, length);
+        Predictor predictor = PredictorFor(column, base, older);
+        for (size_t i = 0; i < length; ++i) {
+            PutWord(tags, payload, written++, ToResidual(words[offset + i], predictor.At(i)));
+        }
+    }
+    frame.payload.resize(static_cast<size_t>(payload - frame.payload.data()));
+}
+
+void RewindService::Decode(const Frame& frame, const std::vector<uint32_t>* base, const std::vector<uint32_t>* older,
+                           std::vector<uint32_t>& words) {
+    words.resize(frame.wordCount);
+    const uint8_t* tags = frame.tags.data();
+    const uint8_t* payload = frame.payload.data();
+
+    Predictor header = PredictorFor(0, base, older);
+    size_t read = 0;
+    for (size_t i = 0; i < HEADER_WORDS; ++i) {
+        words[i] = FromResidual(GetWord(tags, payload, read++), header.At(i));
+    }
+
+    ColumnLayout layout = LayoutOf(words);
+    for (size_t column = 1; column < COLUMN_COUNT; ++column) {
+        size_t offset, length;
+        layout.Get(column, offset, length);
+        Predictor predictor = PredictorFor(column, base, older);
+        for (size_t i = 0; i < length; ++i) {
+            words[offset + i] = FromResidual(GetWord(tags, payload, read++), predictor.At(i));
+        }
+    }
+}
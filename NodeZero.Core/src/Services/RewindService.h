@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "Services/IRewindService.h"
+
+// Each snapshot is flattened to 32-bit words, one column per field, and every word is
+// stored as its difference from a straight-line guess through the same word of the two
+// frames before. Still and steadily moving fields come out zero and the rest small, so
+// each word is stored in 0, 1, 2 or 4 bytes with a 2-bit length tag. Every REWIND_KEYFRAME_INTERVAL frames a keyframe is coded
+// against nothing; history is dropped a whole keyframe group at a time once it is older
+// than REWIND_WINDOW or over REWIND_MAX_BYTES.
+class RewindService : public IRewindService {
+   private:
+    struct Frame {
+        double simTime;
+        bool keyframe;
+        size_t wordCount;
+        std::vector<uint8_t> tags;
+        std::vector<uint8_t> payload;
+    };
+
+    bool m_Enabled;
+    std::deque<Frame> m_Frames;
+    // Storage of evicted frames, reused by the next recordings
+    std::vector<Frame> m_SpareFrames;
+    uint64_t m_FirstSequence;
+    size_t m_FramesSinceKeyframe;
+    size_t m_Bytes;
+    size_t m_FramesBack;
+
+    std::vector<uint32_t> m_OlderWords;
+    std::vector<uint32_t> m_PreviousWords;
+    std::vector<uint32_t> m_CurrentWords;
+
+    // Most recently decoded frame and the one before it, so stepping forward applies one diff
+    std::vector<uint32_t> m_DecodedOlderWords;
+    std::vector<uint32_t> m_DecodedWords;
+    std::vector<uint32_t> m_ScratchWords;
+    uint64_t m_DecodedSequence;
+    bool m_HasDecoded;
+
+   public:
+    RewindService();
+    ~RewindService() override = default;
+
+    void SetEnabled(bool enabled) override;
+    bool IsEnabled() const override;
+    void Record(const WorldSnapshot& snapshot) override;
+    void Clear() override;
+
+    size_t GetFrameCount() const override;
+    size_t GetMemoryUsage() const override;
+
+    bool StepBackward() override;
+    bool StepForward() override;
+    void SeekNewest() override;
+    size_t GetFramesBack() const override;
+    double GetSecondsBack() const override;
+
+    bool ReadFrame(WorldSnapshot& snapshot) override;
+
+   private:
+    void Evict();
+    static void Flatten(const WorldSnapshot& snapshot, std::vector<uint32_t>& words);
+    static void Unflatten(const std::vector<uint32_t>& words, WorldSnapshot& snapshot);
+    static void Encode(const std::vector<uint32_t>& words, const std::vector<uint32_t>* base,
+                       const std::vector<uint32_t>* older, Frame& frame);
+    static void Decode(const Frame& frame, const std::vector<uint32_t>* base, const std::vector<uint32_t>* older,
+                       std::vector<uint32_t>& words);
+};
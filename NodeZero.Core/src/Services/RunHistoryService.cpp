@@ -0,0 +1,214 @@
+#include "RunHistoryService.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Storage/SavePath.h"
+
+static constexpr const char* HISTORY_FILE_NAME = "history.dat";
+
+using RunHistoryFormat::BLOCK_RUNS;
+using RunHistoryFormat::COLUMN_COUNT;
+using RunHistoryFormat::HISTOGRAM_BUCKETS;
+
+RunHistoryService::RunHistoryService(const std::string& path)
+    : RunHistoryService(Backing::File, path.empty() ? GetSaveFilePath(HISTORY_FILE_NAME) : path) {
+}
+
+RunHistoryService::RunHistoryService(Backing backing, const std::string& path)
+    : m_Backing(backing),
+      m_Path(path),
+      m_Data(nullptr) {
+    if (m_Backing == Backing::File) {
+        OpenFile();
+    }
+    if (!m_Data) {
+        OpenMemory();
+    }
+}
+
+void RunHistoryService::OpenFile() {
+    if (!m_File.OpenWritable(m_Path)) {
+        return;
+    }
+
+    if (m_File.GetSize() == 0) {
+        if (m_File.Resize(RunHistoryFormat::HEADER_BYTES)) {
+            m_Data = m_File.GetMutableData();
+            RunHistoryFormat::Initialize(GetHeader());
+            m_File.Flush();
+        }
+    } else if (RunHistoryFormat::IsValid(m_File.GetData(), m_File.GetSize())) {
+        m_Data = m_File.GetMutableData();
+        // A crash between counting a run and storing the count leaves the histograms one ahead
+        const RunHistoryFormat::Header& header = GetHeader();
+        uint64_t counted = 0;
+        for (size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; ++bucket) {
+            counted += header.histograms[0][bucket];
+        }
+        if (counted != header.runCount) {
+            RebuildHistograms();
+        }
+    }
+
+    if (!m_Data) {
+        m_File.Close();
+    }
+}
+
+void RunHistoryService::OpenMemory() {
+    m_Backing = Backing::Memory;
+    m_Memory.assign(RunHistoryFormat::HEADER_BYTES, 0);
+    m_Data = m_Memory.data();
+    RunHistoryFormat::Initialize(GetHeader());
+}
+
+bool RunHistoryService::Grow(size_t size) {
+    if (m_Backing == Backing::Memory) {
+        m_Memory.resize(size, 0);
+        m_Data = m_Memory.data();
+        return true;
+    }
+
+    bool grown = m_File.Resize(size);
+    m_Data = m_File.GetMutableData();
+    if (!m_Data) {
+        // The old mapping could not be restored either
+        m_File.Close();
+        OpenMemory();
+        return false;
+    }
+    return grown;
+}
+
+void RunHistoryService::RebuildHistograms() {
+    RunHistoryFormat::Header& header = GetHeader();
+    for (size_t column = 0; column < COLUMN_COUNT; ++column) {
+        std::fill(header.histograms[column], header.histograms[column] + HISTOGRAM_BUCKETS, 0u);
+        for (uint64_t run = 0; run < header.runCount; ++run) {
+            header.histograms[column][RunHistoryFormat::Bucket(GetValue(column, static_cast<size_t>(run)))]++;
+        }
+    }
+}
+
+void RunHistoryService::Append(const RunRecord& run) {
+    size_t index = static_cast<size_t>(GetHeader().runCount);
+    if (index == GetHeader().blockCount * BLOCK_RUNS) {
+        if (!Grow(RunHistoryFormat::FileSize(GetHeader().blockCount + 1))) {
+            return;
+        }
+        GetHeader().blockCount++;
+    }
+
+    RunHistoryFormat::Header& header = GetHeader();
+    for (size_t column = 0; column < COLUMN_COUNT; ++column) {
+        uint32_t value = GetColumn(run, column);
+        uint64_t total = (index > 0 ? GetTotal(column, index - 1) : 0) + value;
+        *reinterpret_cast<uint32_t*>(m_Data + RunHistoryFormat::ValueOffset(column, index)) = value;
+        *reinterpret_cast<uint64_t*>(m_Data + RunHistoryFormat::TotalOffset(column, index)) = total;
+        header.histograms[column][RunHistoryFormat::Bucket(value)]++;
+    }
+    // Stored last, so a run only counts once all of it is in place
+    header.runCount = index + 1;
+
+    if (m_Backing == Backing::File) {
+        m_File.Flush();
+    }
+}
+
+size_t RunHistoryService::GetRunCount() const {
+    return static_cast<size_t>(GetHeader().runCount);
+}
+
+RunRecord RunHistoryService::GetRun(size_t index) const {
+    RunRecord run;
+    if (index >= GetRunCount()) {
+        return run;
+    }
+    run.levelReached = GetValue(static_cast<size_t>(RunStat::LevelReached), index);
+    run.durationMilliseconds = GetValue(static_cast<size_t>(RunStat::Duration), index);
+    run.points = GetValue(static_cast<size_t>(RunStat::Points), index);
+    run.nodesDestroyed = GetValue(static_cast<size_t>(RunStat::NodesDestroyed), index);
+    run.upgrades = GetValue(static_cast<size_t>(RunStat::Upgrades), index);
+    return run;
+}
+
+double RunHistoryService::GetPercentile(RunStat stat, float fraction) const {
+    const RunHistoryFormat::Header& header = GetHeader();
+    if (header.runCount == 0) {
+        return 0.0;
+    }
+
+    // The smallest bucket that reaches the rank of the fraction, counting from 1
+    double rank = std::ceil(static_cast<double>(std::clamp(fraction, 0.0f, 1.0f)) * header.runCount);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(rank));
+    const uint32_t* histogram = header.histograms[static_cast<size_t>(stat)];
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; ++bucket) {
+        seen += histogram[bucket];
+        if (seen >= target) {
+            return ToStatUnits(stat, RunHistoryFormat::BucketValue(bucket));
+        }
+    }
+    return 0.0;
+}
+
+double RunHistoryService::GetAverage(RunStat stat, size_t first, size_t count) const {
+    size_t runCount = GetRunCount();
+    if (first >= runCount) {
+        return 0.0;
+    }
+    count = std::min(count, runCount - first);
+    if (count == 0) {
+        return 0.0;
+    }
+
+    size_t column = static_cast<size_t>(stat);
+    uint64_t sum = GetTotal(column, first + count - 1) - (first > 0 ? GetTotal(column, first - 1) : 0);
+    return ToStatUnits(stat, static_cast<double>(sum) / static_cast<double>(count));
+}
+
+bool RunHistoryService::IsPersistent() const {
+    return m_Backing == Backing::File;
+}
+
+const std::string& RunHistoryService::GetPath() const {
+    return m_Path;
+}
+
+// The header and every column start at least 8-byte aligned, so they are used in place
+RunHistoryFormat::Header& RunHistoryService::GetHeader() {
+    return *reinterpret_cast<RunHistoryFormat::Header*>(m_Data);
+}
+
+const RunHistoryFormat::Header& RunHistoryService::GetHeader() const {
+    return *reinterpret_cast<const RunHistoryFormat::Header*>(m_Data);
+}
+
+uint32_t RunHistoryService::GetValue(size_t column, size_t run) const {
+    return *reinterpret_cast<const uint32_t*>(m_Data + RunHistoryFormat::ValueOffset(column, run));
+}
+
+uint64_t RunHistoryService::GetTotal(size_t column, size_t run) const {
+    return *reinterpret_cast<const uint64_t*>(m_Data + RunHistoryFormat::TotalOffset(column, run));
+}
+
+uint32_t RunHistoryService::GetColumn(const RunRecord& run, size_t column) {
+    switch (static_cast<RunStat>(column)) {
+        case RunStat::LevelReached:
+            return run.levelReached;
+        case RunStat::Duration:
+            return run.durationMilliseconds;
+        case RunStat::Points:
+            return run.points;
+        case RunStat::NodesDestroyed:
+            return run.nodesDestroyed;
+        case RunStat::Upgrades:
+            return run.upgrades;
+    }
+    return 0;
+}
+
+double RunHistoryService::ToStatUnits(RunStat stat, double value) {
+    return stat == RunStat::Duration ? value / 1000.0 : value;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Services/IRunHistoryService.h"
+#include "Storage/MappedFile.h"
+#include "Storage/RunHistoryFormat.h"
+
+// Keeps the history in a file mapped read-write, laid out as in RunHistoryFormat. Appending
+// writes one value and one running total per column and bumps a histogram bucket per column,
+// so percentiles walk a fixed number of buckets and averages subtract two totals. Only the
+// pages a query touches are read in. A file that holds something else is left alone and the
+// history is kept in memory for the session.
+class RunHistoryService : public IRunHistoryService {
+   protected:
+    enum class Backing {
+        File,
+        Memory
+    };
+
+   private:
+    Backing m_Backing;
+    std::string m_Path;
+    MappedFile m_File;
+    std::vector<uint8_t> m_Memory;
+    // Start of the header, in the mapping or in m_Memory
+    uint8_t* m_Data;
+
+   public:
+    // An empty path uses history.dat in the save directory.
+    explicit RunHistoryService(const std::string& path = "");
+    ~RunHistoryService() override = default;
+
+    void Append(const RunRecord& run) override;
+    size_t GetRunCount() const override;
+    RunRecord GetRun(size_t index) const override;
+
+    double GetPercentile(RunStat stat, float fraction) const override;
+    double GetAverage(RunStat stat, size_t first, size_t count) const override;
+
+    // False when the history could not be kept in the file.
+    bool IsPersistent() const;
+    const std::string& GetPath() const;
+
+   protected:
+    RunHistoryService(Backing backing, const std::string& path);
+
+   private:
+    void OpenFile();
+    void OpenMemory();
+    bool Grow(size_t size);
+    void RebuildHistograms();
+
+    RunHistoryFormat::Header& GetHeader();
+    const RunHistoryFormat::Header& GetHeader() const;
+    uint32_t GetValue(size_t column, size_t run) const;
+    uint64_t GetTotal(size_t column, size_t run) const;
+
+    static uint32_t GetColumn(const RunRecord& run, size_t column);
+    static double ToStatUnits(RunStat stat, double value);
+};
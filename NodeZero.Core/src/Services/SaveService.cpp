@@ -4,44 +4,12 @@
 #include <sstream>
 #include <algorithm>
 
-#ifdef _WIN32
-#include <shlobj.h>
-#include <windows.h>
-#else
-#include <pwd.h>
-#include <sys/types.h>
-#include <unistd.h>
-#endif
+#include "Storage/SavePath.h"
 
 static constexpr const char* SAVE_FILE_NAME = "save.dat";
 
 static std::string GetSavePath() {
-    std::string savePath;
-
-#ifdef _WIN32
-    char appDataPath[MAX_PATH];
-    if (SUCCEEDED(SHGetFolderPathA(NULL, CSIDL_APPDATA, NULL, 0, appDataPath))) {
-        savePath = std::string(appDataPath) + "\\NodeZero\\";
-        CreateDirectoryA(savePath.c_str(), NULL);
-    } else {
-        savePath = "./";
-    }
-#else
-    const char* homeDir = getenv("HOME");
-    if (homeDir == nullptr) {
-        homeDir = getpwuid(getuid())->pw_dir;
-    }
-
-    if (homeDir != nullptr) {
-        savePath = std::string(homeDir) + "/.local/share/NodeZero/";
-        std::string mkdirCmd = "mkdir -p " + savePath;
-        system(mkdirCmd.c_str());
-    } else {
-        savePath = "./";
-    }
-#endif
-
-    return savePath + SAVE_FILE_NAME;
+    return GetSaveFilePath(SAVE_FILE_NAME);
 }
 
 static bool SaveProgressToFile(const SaveData& data) {
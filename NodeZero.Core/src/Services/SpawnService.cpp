@@ -2,72 +2,135 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 
 #include "Config/GameConfig.h"
+#include "Config/MovementProfiles.h"
+#include "Config/NodeArchetypes.h"
+#include "Math/FastMath.h"
+#include "Services/IRandomService.h"
+
+namespace {
+
+// Outward normal of each edge: top, right, bottom, left.
+constexpr float EDGE_NORMAL_X[4] = {0.0f, 1.0f, 0.0f, -1.0f};
+constexpr float EDGE_NORMAL_Y[4] = {-1.0f, 0.0f, 1.0f, 0.0f};
+
+constexpr float EDGE_INSET = 50.0f;
+constexpr float AIM_SPREAD = 150.0f;
+
+}  // namespace
 
 SpawnService::SpawnService()
     : m_ScreenWidth(0.0f),
       m_ScreenHeight(0.0f),
       m_SpawnTimer(0.0f),
-      m_CurrentLevel(1) {
+      m_CurrentLevel(1),
+      m_RandomService(nullptr),
+      m_LevelTable(&LevelTable::Default()),
+      m_LevelParams(m_LevelTable->Get(1)),
+      m_ScheduleCursor(0),
+      m_ScheduleTime(0.0f),
+      m_ScheduleEnd(0.0f),
+      m_ScheduleSeed(0),
+      m_ScheduleStart(0.0f),
+      m_ScheduleDuration(0.0f),
+      m_ScheduleRoom(GameConfig::OVERLOAD_MAX_NODES),
+      m_ScheduleValid(false),
+      m_Overload(false),
+      m_OverloadRoom(GameConfig::OVERLOAD_MAX_NODES) {
 }
 
 void SpawnService::Initialize(float screenWidth, float screenHeight) {
     m_ScreenWidth = screenWidth;
     m_ScreenHeight = screenHeight;
+    m_ScheduleValid = false;
 }
 
 void SpawnService::UpdateAutoSpawn(float deltaTime) {
     m_SpawnTimer += deltaTime;
+    m_ScheduleTime += deltaTime;
 }
 
 void SpawnService::ResetSpawnTimer() {
     m_SpawnTimer = 0.0f;
+    m_ScheduleTime = 0.0f;
+    m_ScheduleValid = false;
 }
 
 void SpawnService::SetCurrentLevel(int level) {
+    if (level != m_CurrentLevel) {
+        m_ScheduleValid = false;
+    }
     m_CurrentLevel = level;
+    m_LevelParams = m_LevelTable->Get(level);
+}
+
+void SpawnService::SetRandomService(IRandomService* randomService) {
+    m_RandomService = randomService;
+}
+
+void SpawnService::SetLevelTable(const LevelTable* levelTable) {
+    m_LevelTable = levelTable ? levelTable : &LevelTable::Default();
+    m_LevelParams = m_LevelTable->Get(m_CurrentLevel);
+    m_ScheduleValid = false;
+}
+
+void SpawnService::SetOverload(bool overload) {
+    m_Overload = overload;
+    m_ScheduleValid = false;
+}
+
+void SpawnService::SetOverloadRoom(size_t room) {
+    m_OverloadRoom = room;
 }
 
 SpawnInfo SpawnService::GetNextSpawn() const {
+    // Pick random edge to spawn from
+    int edge = RandomInt(4);
+    float edgeLength = (edge % 2 == 0) ? m_ScreenWidth : m_ScreenHeight;
+    float along = RandomRange(EDGE_INSET, edgeLength - EDGE_INSET);
+
+    // Aim towards the center with some randomness
+    float aimX = RandomRange(-AIM_SPREAD, AIM_SPREAD);
+    float aimY = RandomRange(-AIM_SPREAD, AIM_SPREAD);
+
+    NodeShape shape = GetRandomShape();
+    return MakeEdgeSpawn(edge, along, aimX, aimY, shape, ChooseMovement(shape));
+}
+
+SpawnInfo SpawnService::MakeEdgeSpawn(int edge, float along, float aimX, float aimY, NodeShape shape,
+                                      MovementBehavior movement) const {
     float centerX = m_ScreenWidth / 2.0f;
     float centerY = m_ScreenHeight / 2.0f;
-
-    // Pick random edge to spawn from
-    int edge = std::rand() % 4;
     float spawnX, spawnY;
 
     switch (edge) {
         case 0:  // Top
-            spawnX = RandomRange(50.0f, m_ScreenWidth - 50.0f);
-            spawnY = -50.0f;
+            spawnX = along;
+            spawnY = -EDGE_INSET;
             break;
         case 1:  // Right
-            spawnX = m_ScreenWidth + 50.0f;
-            spawnY = RandomRange(50.0f, m_ScreenHeight - 50.0f);
+            spawnX = m_ScreenWidth + EDGE_INSET;
+            spawnY = along;
             break;
         case 2:  // Bottom
-            spawnX = RandomRange(50.0f, m_ScreenWidth - 50.0f);
-            spawnY = m_ScreenHeight + 50.0f;
+            spawnX = along;
+            spawnY = m_ScreenHeight + EDGE_INSET;
             break;
         case 3:  // Left
-            spawnX = -50.0f;
-            spawnY = RandomRange(50.0f, m_ScreenHeight - 50.0f);
+            spawnX = -EDGE_INSET;
+            spawnY = along;
             break;
         default:
             spawnX = centerX;
-            spawnY = -50.0f;
+            spawnY = -EDGE_INSET;
             break;
     }
 
-    // Calculate direction towards center (with some randomness)
-    float offsetRange = 150.0f;
-    float targetX = centerX + RandomRange(-offsetRange, offsetRange);
-    float targetY = centerY + RandomRange(-offsetRange, offsetRange);
-
-    float dirX = targetX - spawnX;
-    float dirY = targetY - spawnY;
+    float dirX = centerX + aimX - spawnX;
+    float dirY = centerY + aimY - spawnY;
 
     float length = std::sqrt(dirX * dirX + dirY * dirY);
     if (length > 0.0f) {
@@ -77,34 +140,261 @@ SpawnInfo SpawnService::GetNextSpawn() const {
 
     return SpawnInfo{
         Position{spawnX, spawnY},
-        GetRandomShape(),
+        shape,
         dirX,
-        dirY
+        dirY,
+        movement
     };
 }
 
+void SpawnService::TakeDueSpawns(std::vector<SpawnInfo>& out) {
+    // Overload segments are short so each build stays small as the rate climbs
+    float segment = m_Overload ? GameConfig::OVERLOAD_SCHEDULE_SEGMENT : GameConfig::SPAWN_SCHEDULE_SEGMENT;
+
+    while (true) {
+        if (!m_ScheduleValid) {
+            BuildSchedule(NextStreamSeed(), m_ScheduleTime, segment);
+        } else if (m_ScheduleCursor >= m_Schedule.size() && m_ScheduleTime >= m_ScheduleEnd) {
+            BuildSchedule(NextStreamSeed(), m_ScheduleEnd, segment);
+        }
+
+        while (m_ScheduleCursor < m_Schedule.size() && m_Schedule[m_ScheduleCursor].time <= m_ScheduleTime) {
+            out.push_back(m_Schedule[m_ScheduleCursor++].info);
+            // Taken but not yet spawned, so a segment built later this call does not count them as room
+            if (m_Overload && m_OverloadRoom > 0) {
+                m_OverloadRoom--;
+            }
+        }
+
+        // Done unless this tick also ran past the end of the segment
+        if (m_ScheduleCursor < m_Schedule.size() || m_ScheduleTime < m_ScheduleEnd) {
+            return;
+        }
+    }
+}
+
+void SpawnService::BuildSchedule(uint32_t seed, float startTime, float duration) {
+    m_Schedule.clear();
+    m_ScheduleCursor = 0;
+    m_ScheduleEnd = startTime + duration;
+    m_ScheduleSeed = seed;
+    m_ScheduleStart = startTime;
+    m_ScheduleDuration = duration;
+    m_ScheduleRoom = m_OverloadRoom;
+    m_ScheduleValid = true;
+
+    uint32_t state = seed != 0 ? seed : 1u;
+
+    if (m_Overload) {
+        AddOverloadStream(startTime, state);
+        return;
+    }
+
+    // The level's regular cadence, one node at a time
+    float interval = std::max(0.01f, m_LevelParams.spawnInterval);
+    for (int k = 1; startTime + k * interval <= m_ScheduleEnd; ++k) {
+        AddSingle(startTime + k * interval, state);
+    }
+
+    // Bursts and formations land around a fixed period, jittered by up to a quarter of it
+    auto addPeriodic = [&](float period, void (SpawnService::*add)(float, uint32_t&)) {
+        for (int k = 1;; ++k) {
+            float time = startTime + period * (k + (FastMath::NextUnit(state) - 0.5f) * 0.5f);
+            if (time > m_ScheduleEnd) {
+                break;
+            }
+            (this->*add)(time, state);
+        }
+    };
+
+    addPeriodic(GameConfig::SPAWN_BURST_INTERVAL, &SpawnService::AddBurst);
+    if (m_CurrentLevel >= GameConfig::SPAWN_FORMATION_FIRST_LEVEL) {
+        addPeriodic(GameConfig::SPAWN_FORMATION_INTERVAL, &SpawnService::AddFormation);
+    }
+
+    std::stable_sort(m_Schedule.begin(), m_Schedule.end(),
+                     [](const ScheduledSpawn& a, const ScheduledSpawn& b) { return a.time < b.time; });
+}
+
+size_t SpawnService::GetScheduledCount() const {
+    return m_Schedule.size();
+}
+
+void SpawnService::AddSingle(float time, uint32_t& state) {
+    int edge = static_cast<int>(FastMath::NextUnit(state) * 4.0f);
+    float edgeLength = (edge % 2 == 0) ? m_ScreenWidth : m_ScreenHeight;
+    float along = EDGE_INSET + FastMath::NextUnit(state) * (edgeLength - 2.0f * EDGE_INSET);
+    float aimX = (FastMath::NextUnit(state) * 2.0f - 1.0f) * AIM_SPREAD;
+    float aimY = (FastMath::NextUnit(state) * 2.0f - 1.0f) * AIM_SPREAD;
+    NodeShape shape = ShapeFromRoll(static_cast<int>(FastMath::NextUnit(state) * 100.0f));
+
+    MovementBehavior unlocked[MovementProfiles::COUNT];
+    int count = UnlockedMovements(shape, unlocked);
+    MovementBehavior movement = MovementBehavior::Linear;
+    if (count > 0) {
+        movement = unlocked[std::min(count - 1, static_cast<int>(FastMath::NextUnit(state) * count))];
+    }
+
+    m_Schedule.push_back(ScheduledSpawn{time, MakeEdgeSpawn(edge, along, aimX, aimY, shape, movement)});
+}
+
+void SpawnService::AddBurst(float time, uint32_t& state) {
+    // A cluster from one point of one edge, fanning out toward the center
+    int edge = static_cast<int>(FastMath::NextUnit(state) * 4.0f);
+    float edgeLength = (edge % 2 == 0) ? m_ScreenWidth : m_ScreenHeight;
+    float along = EDGE_INSET + FastMath::NextUnit(state) * (edgeLength - 2.0f * EDGE_INSET);
+    NodeShape shape = ShapeFromRoll(static_cast<int>(FastMath::NextUnit(state) * 100.0f));
+    int size = GameConfig::SPAWN_BURST_MIN +
+               static_cast<int>(FastMath::NextUnit(state) * (GameConfig::SPAWN_BURST_MAX - GameConfig::SPAWN_BURST_MIN + 1));
+    float spread = m_ScreenHeight * GameConfig::SPAWN_FORMATION_SPACING;
+
+    for (int i = 0; i < size; ++i) {
+        float offset = (FastMath::NextUnit(state) - 0.5f) * spread;
+        float aimX = (FastMath::NextUnit(state) * 2.0f - 1.0f) * AIM_SPREAD;
+        float aimY = (FastMath::NextUnit(state) * 2.0f - 1.0f) * AIM_SPREAD;
+        m_Schedule.push_back(
+            ScheduledSpawn{time, MakeEdgeSpawn(edge, along + offset, aimX, aimY, shape, MovementBehavior::Linear)});
+    }
+}
+
+void SpawnService::AddFormation(float time, uint32_t& state) {
+    // A block of rows marching straight across from one edge
+    int edge = static_cast<int>(FastMath::NextUnit(state) * 4.0f);
+    float edgeLength = (edge % 2 == 0) ? m_ScreenWidth : m_ScreenHeight;
+    NodeShape shape = ShapeFromRoll(static_cast<int>(FastMath::NextUnit(state) * 100.0f));
+    int size = std::min(GameConfig::SPAWN_FORMATION_MAX,
+                        GameConfig::SPAWN_FORMATION_BASE + GameConfig::SPAWN_FORMATION_PER_LEVEL * m_CurrentLevel);
+
+    float spacing = m_ScreenHeight * GameConfig::SPAWN_FORMATION_SPACING;
+    int columns = std::max(1, static_cast<int>((edgeLength - 2.0f * EDGE_INSET) / spacing));
+    float firstAlong = (edgeLength - (columns - 1) * spacing) / 2.0f;
+
+    for (int i = 0; i < size; ++i) {
+        int column = i % columns;
+        int row = i / columns;
+
+        SpawnInfo info = MakeEdgeSpawn(edge, firstAlong + column * spacing, 0.0f, 0.0f, shape, MovementBehavior::Linear);
+        info.position.x += EDGE_NORMAL_X[edge] * spacing * row;
+        info.position.y += EDGE_NORMAL_Y[edge] * spacing * row;
+        info.directionX = -EDGE_NORMAL_X[edge];
+        info.directionY = -EDGE_NORMAL_Y[edge];
+        m_Schedule.push_back(ScheduledSpawn{time, info});
+    }
+}
+
+void SpawnService::AddOverloadStream(float startTime, uint32_t& state) {
+    // The ramp stops once one segment could fill the field on its own
+    static const float maxDoublings = std::log2(static_cast<float>(GameConfig::OVERLOAD_MAX_NODES) /
+                                                (GameConfig::OVERLOAD_START_RATE * GameConfig::OVERLOAD_SCHEDULE_SEGMENT));
+
+    // Time is measured from the start of the run, so the ramp carries across segments
+    float time = startTime;
+    size_t room = m_ScheduleRoom;
+    while (room > 0) {
+        float doublings = std::min(time / GameConfig::OVERLOAD_DOUBLING_TIME, maxDoublings);
+        float rate = GameConfig::OVERLOAD_START_RATE * std::exp2(doublings);
+        float interval = std::max(GameConfig::OVERLOAD_MIN_INTERVAL, 1.0f / rate);
+        time += interval;
+        if (time > m_ScheduleEnd) {
+            break;
+        }
+
+        float wanted = std::min(rate * interval, static_cast<float>(GameConfig::OVERLOAD_MAX_NODES));
+        size_t batch = std::min(room, static_cast<size_t>(std::max(1L, std::lround(wanted))));
+        for (size_t i = 0; i < batch; ++i) {
+            AddSingle(time, state);
+        }
+        room -= batch;
+    }
+}
+
+int SpawnService::UnlockedMovements(NodeShape shape, MovementBehavior* out) const {
+    uint32_t allowed = NodeArchetypes::Get(shape).movements;
+    int count = 0;
+
+    for (int i = 0; i < MovementProfiles::COUNT; ++i) {
+        MovementBehavior behavior = static_cast<MovementBehavior>(i);
+        if ((allowed & MovementProfiles::Bit(behavior)) &&
+            MovementProfiles::Get(behavior).unlockLevel <= m_CurrentLevel) {
+            out[count++] = behavior;
+        }
+    }
+    return count;
+}
+
+MovementBehavior SpawnService::ChooseMovement(NodeShape shape) const {
+    // Uniform over the behaviors the shape allows and the level has unlocked
+    MovementBehavior unlocked[MovementProfiles::COUNT];
+    int count = UnlockedMovements(shape, unlocked);
+
+    if (count == 0) {
+        return MovementBehavior::Linear;
+    }
+    // No draw while there is only one choice, so early levels keep their random sequence
+    return count == 1 ? unlocked[0] : unlocked[RandomInt(count)];
+}
+
 NodeShape SpawnService::GetRandomShape() const {
-    int chance = std::rand() % 100;
+    return ShapeFromRoll(RandomInt(100));
+}
 
-    if (chance < 60) {
+NodeShape SpawnService::ShapeFromRoll(int roll) {
+    if (roll < 60) {
         return NodeShape::Square;
-    } else if (chance < 90) {
+    } else if (roll < 90) {
         return NodeShape::Circle;
     } else {
         return NodeShape::Hexagon;
     }
 }
 
+uint32_t SpawnService::NextStreamSeed() const {
+    uint32_t seed = static_cast<uint32_t>(RandomInt(0x7FFFFFFF));
+    seed = seed * 2654435761u ^ 0x9E3779B9u;
+    return seed != 0 ? seed : 1u;
+}
+
 float SpawnService::CalculateNodeHP(float baseHP) const {
-    return baseHP * (1.0f + (m_CurrentLevel - 1) * 0.2f);
+    return baseHP * m_LevelParams.nodeHPScale;
 }
 
 float SpawnService::RandomRange(float minValue, float maxValue) const {
+    if (m_RandomService) {
+        return m_RandomService->Range(minValue, maxValue);
+    }
     float t = static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
     return minValue + (maxValue - minValue) * t;
 }
 
+int SpawnService::RandomInt(int maxExclusive) const {
+    if (m_RandomService) {
+        return m_RandomService->NextInt(maxExclusive);
+    }
+    return std::rand() % maxExclusive;
+}
+
 bool SpawnService::ShouldAutoSpawn() const {
-    float currentSpawnInterval = std::max(0.5f, 2.0f - (m_CurrentLevel - 1) * 0.15f);
-    return m_SpawnTimer >= currentSpawnInterval;
+    return m_SpawnTimer >= m_LevelParams.spawnInterval;
+}
+
+void SpawnService::SaveCheckpoint(SpawnCheckpoint& checkpoint) const {
+    checkpoint.spawnTimer = m_SpawnTimer;
+    checkpoint.scheduleTime = m_ScheduleTime;
+    checkpoint.scheduleStart = m_ScheduleStart;
+    checkpoint.scheduleDuration = m_ScheduleDuration;
+    checkpoint.scheduleSeed = m_ScheduleSeed;
+    checkpoint.scheduleRoom = static_cast<uint32_t>(m_ScheduleRoom);
+    checkpoint.scheduleCursor = static_cast<uint32_t>(m_ScheduleCursor);
+    checkpoint.scheduleValid = m_ScheduleValid ? 1 : 0;
+}
+
+void SpawnService::LoadCheckpoint(const SpawnCheckpoint& checkpoint) {
+    m_SpawnTimer = checkpoint.spawnTimer;
+    m_ScheduleTime = checkpoint.scheduleTime;
+    m_ScheduleValid = false;
+    if (checkpoint.scheduleValid) {
+        m_OverloadRoom = checkpoint.scheduleRoom;
+        BuildSchedule(checkpoint.scheduleSeed, checkpoint.scheduleStart, checkpoint.scheduleDuration);
+        m_ScheduleCursor = std::min<size_t>(checkpoint.scheduleCursor, m_Schedule.size());
+    }
 }
@@ -1,14 +1,48 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Config/LevelTable.h"
+#include "Enums/MovementBehavior.h"
 #include "Enums/NodeShape.h"
 #include "Services/ISpawnService.h"
+#include "Types/Checkpoint.h"
+
+class IRandomService;
 
+// Spawns are precomputed a segment at a time: the level's regular cadence plus bursts and
+// formations, all drawn from one seed and sorted by time. Each tick only walks a cursor
+// over the schedule, however many nodes a formation holds.
 class SpawnService : public ISpawnService {
    private:
+    struct ScheduledSpawn {
+        float time;
+        SpawnInfo info;
+    };
+
     float m_ScreenWidth;
     float m_ScreenHeight;
     float m_SpawnTimer;
     int m_CurrentLevel;
+    IRandomService* m_RandomService;
+    const LevelTable* m_LevelTable;
+    LevelParams m_LevelParams;
+
+    std::vector<ScheduledSpawn> m_Schedule;
+    size_t m_ScheduleCursor;
+    float m_ScheduleTime;
+    float m_ScheduleEnd;
+    // What the current segment was built from, so a checkpoint can rebuild it
+    uint32_t m_ScheduleSeed;
+    float m_ScheduleStart;
+    float m_ScheduleDuration;
+    size_t m_ScheduleRoom;
+    bool m_ScheduleValid;
+    bool m_Overload;
+    // Nodes overload may still add; a segment never schedules more than this
+    size_t m_OverloadRoom;
 
    public:
     SpawnService();
@@ -16,15 +50,46 @@ class SpawnService : public ISpawnService {
 
     void Initialize(float screenWidth, float screenHeight);
     void UpdateAutoSpawn(float deltaTime) override;
+    // Also restarts the schedule; the next segment is built on the next update.
     void ResetSpawnTimer();
 
     void SetCurrentLevel(int level);
+    void SetRandomService(IRandomService* randomService);
+    void SetLevelTable(const LevelTable* levelTable);
+    // In overload the schedule is a stream of growing batches with no floor on the interval.
+    void SetOverload(bool overload);
+    // How many more nodes the game will take, set each tick before TakeDueSpawns.
+    void SetOverloadRoom(size_t room);
 
     SpawnInfo GetNextSpawn() const override;
+    void TakeDueSpawns(std::vector<SpawnInfo>& out) override;
     float CalculateNodeHP(float baseHP) const override;
     bool ShouldAutoSpawn() const override;
 
+    // Replaces the schedule with the segment [startTime, startTime + duration) drawn from seed.
+    void BuildSchedule(uint32_t seed, float startTime, float duration);
+    size_t GetScheduledCount() const;
+
+    // Load after the level and overload flag are set; the segment is rebuilt for them.
+    void SaveCheckpoint(SpawnCheckpoint& checkpoint) const;
+    void LoadCheckpoint(const SpawnCheckpoint& checkpoint);
+
    private:
     float RandomRange(float minValue, float maxValue) const;
+    int RandomInt(int maxExclusive) const;
+    // One draw from the shared RNG seeds each schedule segment.
+    uint32_t NextStreamSeed() const;
     NodeShape GetRandomShape() const;
+    MovementBehavior ChooseMovement(NodeShape shape) const;
+
+    // Shared by single spawns and the schedule so both place nodes the same way.
+    SpawnInfo MakeEdgeSpawn(int edge, float along, float aimX, float aimY, NodeShape shape,
+                            MovementBehavior movement) const;
+    static NodeShape ShapeFromRoll(int roll);
+    int UnlockedMovements(NodeShape shape, MovementBehavior* out) const;
+
+    void AddSingle(float time, uint32_t& state);
+    void AddBurst(float time, uint32_t& state);
+    void AddFormation(float time, uint32_t& state);
+    void AddOverloadStream(float startTime, uint32_t& state);
 };
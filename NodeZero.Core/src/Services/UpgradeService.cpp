@@ -1,5 +1,8 @@
 #include "UpgradeService.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "Config/GameConfig.h"
 #include "Services/ISaveService.h"
 #include "Types/SaveData.h"
@@ -130,3 +133,14 @@ int UpgradeService::GetDamageUpgradeCost() const {
 float UpgradeService::GetDamagePerTick() const {
     return m_DamagePerTick;
 }
+
+int UpgradeService::GetUpgradeCount() const {
+    auto steps = [](float value, float base, float amount) {
+        return std::max(0, static_cast<int>(std::lround((value - base) / amount)));
+    };
+    // The zone's last step may be cut short by DAMAGE_ZONE_MAX_SIZE, so it rounds up
+    int zoneSteps = static_cast<int>(std::ceil(
+        (m_DamageZoneSize - GameConfig::DAMAGE_ZONE_DEFAULT_SIZE) / GameConfig::DAMAGE_ZONE_UPGRADE_AMOUNT - 0.01f));
+    return steps(m_MaxHealth, GameConfig::HEALTH_DEFAULT, 1.0f) + steps(m_RegenRate, 0.0f, GameConfig::REGEN_UPGRADE_AMOUNT) +
+           std::max(0, zoneSteps) + steps(m_DamagePerTick, GameConfig::DAMAGE_PER_TICK_DEFAULT, GameConfig::DAMAGE_UPGRADE_AMOUNT);
+}
@@ -34,4 +34,6 @@ class UpgradeService : public IUpgradeService {
     bool BuyDamageUpgrade() override;
     int GetDamageUpgradeCost() const override;
     float GetDamagePerTick() const override;
+
+    int GetUpgradeCount() const override;
 };
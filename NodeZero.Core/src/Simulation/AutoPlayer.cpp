@@ -0,0 +1,212 @@
+#include "AutoPlayer.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Config/GameConfig.h"
+#include "Config/NodeArchetypes.h"
+#include "IGame.h"
+
+AutoPlayer::AutoPlayer(AutoPlayerPolicy policy)
+    : m_Policy(policy),
+      m_CursorSpeed(GameConfig::AUTOPLAY_CURSOR_SPEED),
+      m_Cursor{0.0f, 0.0f},
+      m_HasCursor(false),
+      m_MaxNodeRadius(0.0f),
+      m_MaxPickupSize(0.0f) {
+}
+
+Position AutoPlayer::Update(IGame& game, float deltaTime) {
+    if (!m_HasCursor) {
+        m_Cursor = Position{game.GetScreenWidth() / 2.0f, game.GetScreenHeight() / 2.0f};
+        m_HasCursor = true;
+    }
+
+    Position target = ChooseTarget(game);
+
+    float deltaX = target.x - m_Cursor.x;
+    float deltaY = target.y - m_Cursor.y;
+    float distance = std::sqrt(deltaX * deltaX + deltaY * deltaY);
+    float maxStep = m_CursorSpeed * deltaTime;
+
+    if (distance <= maxStep || distance <= 0.0f) {
+        m_Cursor = target;
+    } else {
+        m_Cursor.x += deltaX / distance * maxStep;
+        m_Cursor.y += deltaY / distance * maxStep;
+    }
+
+    game.SetMousePosition(m_Cursor.x, m_Cursor.y);
+    return m_Cursor;
+}
+
+Position AutoPlayer::ChooseTarget(IGame& game) {
+    if (!m_HasCursor) {
+        m_Cursor = Position{game.GetScreenWidth() / 2.0f, game.GetScreenHeight() / 2.0f};
+        m_HasCursor = true;
+    }
+
+    Gather(game);
+
+    float zoneSize = m_Snapshot.damageZoneSize;
+    Position target = m_Cursor;
+
+    switch (m_Policy) {
+        case AutoPlayerPolicy::MostHPInZone:
+            FindMostHP(zoneSize, target);
+            break;
+        case AutoPlayerPolicy::NearestPickupCluster:
+            FindPickupCluster(zoneSize, target);
+            break;
+        case AutoPlayerPolicy::Balanced:
+            // Bank what is already on the field before chasing more damage.
+            if (!FindPickupCluster(zoneSize, target)) {
+                FindMostHP(zoneSize, target);
+            }
+            break;
+    }
+
+    return target;
+}
+
+void AutoPlayer::SetPolicy(AutoPlayerPolicy policy) {
+    m_Policy = policy;
+}
+
+AutoPlayerPolicy AutoPlayer::GetPolicy() const {
+    return m_Policy;
+}
+
+void AutoPlayer::SetCursorSpeed(float speed) {
+    m_CursorSpeed = speed;
+}
+
+Position AutoPlayer::GetCursor() const {
+    return m_Cursor;
+}
+
+void AutoPlayer::Gather(IGame& game) {
+    m_NodeXs.clear();
+    m_NodeYs.clear();
+    m_NodeRadii.clear();
+    m_NodeHPs.clear();
+    m_MaxNodeRadius = 0.0f;
+
+    game.CaptureSnapshot(m_Snapshot);
+
+    for (const NodeSnapshot& node : m_Snapshot.nodes) {
+        float radius = node.size * NodeArchetypes::Get(node.shape).radiusFactor;
+
+        m_NodeXs.push_back(node.x);
+        m_NodeYs.push_back(node.y);
+        m_NodeRadii.push_back(radius);
+        m_MaxNodeRadius = std::max(m_MaxNodeRadius, radius);
+        m_NodeHPs.push_back(node.hp);
+    }
+
+    m_PickupXs.clear();
+    m_PickupYs.clear();
+    m_PickupSizes.clear();
+    m_MaxPickupSize = 0.0f;
+
+    for (const PickupSnapshot& pickup : m_Snapshot.pickups) {
+        m_PickupXs.push_back(pickup.position.x);
+        m_PickupYs.push_back(pickup.position.y);
+        m_PickupSizes.push_back(pickup.size);
+        m_MaxPickupSize = std::max(m_MaxPickupSize, pickup.size);
+    }
+
+    float zoneSize = m_Snapshot.damageZoneSize;
+    m_NodeGrid.Build(m_NodeXs.data(), m_NodeYs.data(), m_NodeXs.size(), zoneSize);
+    m_PickupGrid.Build(m_PickupXs.data(), m_PickupYs.data(), m_PickupXs.size(), zoneSize);
+}
+
+bool AutoPlayer::FindMostHP(float zoneSize, Position& target) const {
+    size_t count = m_NodeXs.size();
+    if (count == 0) {
+        return false;
+    }
+
+    size_t stride = std::max<size_t>(1, count / GameConfig::AUTOPLAY_MAX_CANDIDATES);
+    float bestScore = 0.0f;
+    bool found = false;
+
+    for (size_t i = 0; i < count; i += stride) {
+        float score = ScoreNodes(m_NodeXs[i], m_NodeYs[i], zoneSize);
+
+        float deltaX = m_NodeXs[i] - m_Cursor.x;
+        float deltaY = m_NodeYs[i] - m_Cursor.y;
+        score /= 1.0f + std::sqrt(deltaX * deltaX + deltaY * deltaY) / m_CursorSpeed;
+
+        if (score > bestScore) {
+            bestScore = score;
+            target = Position{m_NodeXs[i], m_NodeYs[i]};
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+bool AutoPlayer::FindPickupCluster(float zoneSize, Position& target) const {
+    size_t count = m_PickupXs.size();
+    if (count == 0) {
+        return false;
+    }
+
+    size_t stride = std::max<size_t>(1, count / GameConfig::AUTOPLAY_MAX_CANDIDATES);
+    float bestScore = 0.0f;
+    bool found = false;
+
+    for (size_t i = 0; i < count; i += stride) {
+        float deltaX = m_PickupXs[i] - m_Cursor.x;
+        float deltaY = m_PickupYs[i] - m_Cursor.y;
+        float distance = std::sqrt(deltaX * deltaX + deltaY * deltaY);
+        float score = CountPickups(m_PickupXs[i], m_PickupYs[i], zoneSize) / (1.0f + distance / zoneSize);
+
+        if (score > bestScore) {
+            bestScore = score;
+            target = Position{m_PickupXs[i], m_PickupYs[i]};
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+float AutoPlayer::ScoreNodes(float centerX, float centerY, float zoneSize) const {
+    float half = zoneSize / 2.0f;
+    float left = centerX - half;
+    float top = centerY - half;
+    float right = centerX + half;
+    float bottom = centerY + half;
+    float score = 0.0f;
+
+    m_NodeGrid.QueryRadius(centerX, centerY, half + m_MaxNodeRadius, [&](uint32_t index) {
+        float closestX = std::max(left, std::min(m_NodeXs[index], right));
+        float closestY = std::max(top, std::min(m_NodeYs[index], bottom));
+        float deltaX = m_NodeXs[index] - closestX;
+        float deltaY = m_NodeYs[index] - closestY;
+
+        if (deltaX * deltaX + deltaY * deltaY <= m_NodeRadii[index] * m_NodeRadii[index]) {
+            score += m_NodeHPs[index];
+        }
+    });
+
+    return score;
+}
+
+int AutoPlayer::CountPickups(float centerX, float centerY, float zoneSize) const {
+    float half = zoneSize / 2.0f;
+    int count = 0;
+
+    m_PickupGrid.QueryRadius(centerX, centerY, half + m_MaxPickupSize, [&](uint32_t index) {
+        float size = m_PickupSizes[index];
+        if (std::abs(m_PickupXs[index] - centerX) <= half + size &&
+            std::abs(m_PickupYs[index] - centerY) <= half + size) {
+            count++;
+        }
+    });
+
+    return count;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+
+#include "Spatial/SpatialGrid.h"
+#include "Types/Position.h"
+#include "Types/WorldSnapshot.h"
+
+class IGame;
+
+enum class AutoPlayerPolicy {
+    MostHPInZone,
+    NearestPickupCluster,
+    Balanced
+};
+
+// Drives the damage zone without a mouse. Each tick it scores a bounded set of
+// candidate zone centers against grids of the live nodes and pickups, then moves
+// the cursor toward the best one at a capped speed.
+class AutoPlayer {
+   private:
+    AutoPlayerPolicy m_Policy;
+    float m_CursorSpeed;
+    Position m_Cursor;
+    bool m_HasCursor;
+    float m_MaxNodeRadius;
+    float m_MaxPickupSize;
+
+    WorldSnapshot m_Snapshot;
+
+    std::vector<float> m_NodeXs;
+    std::vector<float> m_NodeYs;
+    std::vector<float> m_NodeRadii;
+    std::vector<float> m_NodeHPs;
+    std::vector<float> m_PickupXs;
+    std::vector<float> m_PickupYs;
+    std::vector<float> m_PickupSizes;
+    SpatialGrid m_NodeGrid;
+    SpatialGrid m_PickupGrid;
+
+   public:
+    explicit AutoPlayer(AutoPlayerPolicy policy = AutoPlayerPolicy::Balanced);
+
+    // Picks a target, steps the cursor and forwards it to the game.
+    Position Update(IGame& game, float deltaTime);
+    Position ChooseTarget(IGame& game);
+
+    void SetPolicy(AutoPlayerPolicy policy);
+    AutoPlayerPolicy GetPolicy() const;
+    void SetCursorSpeed(float speed);
+    Position GetCursor() const;
+
+   private:
+    void Gather(IGame& game);
+    bool FindMostHP(float zoneSize, Position& target) const;
+    bool FindPickupCluster(float zoneSize, Position& target) const;
+    float ScoreNodes(float centerX, float centerY, float zoneSize) const;
+    int CountPickups(float centerX, float centerY, float zoneSize) const;
+};
@@ -0,0 +1,203 @@
+#include "BatchSimulator.h"
+
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include "Game.h"
+#include "Services/ClockService.h"
+#include "Services/GameServices.h"
+#include "Services/IHealthService.h"
+#include "Services/ILevelService.h"
+#include "Services/IPickupService.h"
+#include "Services/IUpgradeService.h"
+#include "ThreadPool.h"
+
+// Enough coins to buy any swept configuration up front.
+static constexpr int UPGRADE_BUDGET = 1000000;
+
+BatchSimulator::BatchSimulator(BatchSimulationConfig config)
+    : m_Config(std::move(config)) {
+}
+
+std::vector<SweepCellReport> BatchSimulator::Run() {
+    std::vector<SweepCellReport> reports;
+    for (int level : m_Config.startLevels) {
+        for (const UpgradeConfig& upgrades : m_Config.upgradeConfigs) {
+            SweepCellReport report;
+            report.startLevel = level;
+            report.upgrades = upgrades;
+            report.runs.resize(m_Config.runsPerConfig);
+            reports.push_back(report);
+        }
+    }
+
+    {
+        ThreadPool pool(m_Config.threadCount);
+        uint64_t runIndex = 0;
+
+        for (SweepCellReport& report : reports) {
+            for (SimulationRunResult& result : report.runs) {
+                uint64_t seed = m_Config.baseSeed * 6364136223846793005ull + runIndex++;
+                const SweepCellReport* cell = &report;
+                SimulationRunResult* slot = &result;
+
+                pool.Submit([this, cell, slot, seed]() {
+                    *slot = RunSingle(m_Config, cell->startLevel, cell->upgrades, seed);
+                });
+            }
+        }
+
+        pool.WaitIdle();
+    }
+
+    for (SweepCellReport& report : reports) {
+        std::vector<float> survival;
+        std::vector<float> pointsPerMinute;
+        std::vector<float> nodesDestroyed;
+        survival.reserve(report.runs.size());
+        pointsPerMinute.reserve(report.runs.size());
+        nodesDestroyed.reserve(report.runs.size());
+
+        for (const SimulationRunResult& result : report.runs) {
+            survival.push_back(result.survivalTime);
+            pointsPerMinute.push_back(result.GetPointsPerMinute());
+            nodesDestroyed.push_back(static_cast<float>(result.nodesDestroyed));
+        }
+
+        report.survivalTime = Histogram::Build(std::move(survival), m_Config.histogramBuckets);
+        report.pointsPerMinute = Histogram::Build(std::move(pointsPerMinute), m_Config.histogramBuckets);
+        report.nodesDestroyed = Histogram::Build(std::move(nodesDestroyed), m_Config.histogramBuckets);
+    }
+
+    return reports;
+}
+
+SimulationRunResult BatchSimulator::RunSingle(const BatchSimulationConfig& config, int startLevel,
+                                              const UpgradeConfig& upgrades, uint64_t seed) {
+    SaveData saveData;
+    saveData.currentLevel = startLevel;
+    saveData.points = UPGRADE_BUDGET;
+
+    Game game(GameServices::CreateInMemory(seed, saveData));
+    game.SetLevelTable(config.levelTable);
+    game.Initialize(config.screenWidth, config.screenHeight);
+
+    ApplyUpgrades(game.GetUpgradeService(), upgrades);
+
+    IHealthService& health = game.GetHealthService();
+    health.SetMaxHealth(game.GetUpgradeService().GetMaxHealth());
+    health.SetRegenRate(game.GetUpgradeService().GetRegenRate());
+    health.RestoreToMax();
+
+    AutoPlayer autoPlayer(config.autoPlayerPolicy);
+
+    SimulationRunResult result;
+    int pointsFromClearedLevels = 0;
+    float elapsed = 0.0f;
+
+    while (elapsed < config.maxDuration) {
+        if (config.cursorPolicy) {
+            Position target = config.cursorPolicy(game, elapsed);
+            game.SetMousePosition(target.x, target.y);
+        } else {
+            autoPlayer.Update(game, config.timeStep);
+        }
+        game.Update(config.timeStep);
+        elapsed += config.timeStep;
+
+        if (health.IsZero()) {
+            break;
+        }
+
+        if (game.GetLevelService().IsLevelCompleted()) {
+            pointsFromClearedLevels += game.GetPickupService().GetPickupPoints();
+            game.StartNextLevel();
+        }
+    }
+
+    result.survivalTime = elapsed;
+    result.survived = !health.IsZero();
+    result.points = pointsFromClearedLevels + game.GetPickupService().GetPickupPoints();
+    result.nodesDestroyed = game.GetNodesDestroyed();
+    result.levelReached = game.GetLevelService().GetCurrentLevel();
+    return result;
+}
+
+std::vector<OverloadSample> BatchSimulator::RunOverload(const BatchSimulationConfig& config, uint64_t seed,
+                                                       float sampleInterval) {
+    // Ticks are timed on the wall clock; the rest of the run stays deterministic
+    GameServices services = GameServices::CreateInMemory(seed);
+    services.clockService = std::make_unique<ClockService>();
+    Game game(std::move(services));
+    game.SetLevelTable(config.levelTable);
+    game.Initialize(config.screenWidth, config.screenHeight);
+    game.SetGameMode(GameMode::Overload);
+    game.Reset();
+
+    ThreadPool pool(config.threadCount);
+    game.SetThreadPool(&pool);
+
+    AutoPlayer autoPlayer(config.autoPlayerPolicy);
+
+    std::vector<OverloadSample> samples;
+    OverloadSample window;
+    int windowTicks = 0;
+    double windowNodeTicks = 0.0;
+    float elapsed = 0.0f;
+
+    while (elapsed < config.maxDuration) {
+        if (config.cursorPolicy) {
+            Position target = config.cursorPolicy(game, elapsed);
+            game.SetMousePosition(target.x, target.y);
+        } else {
+            autoPlayer.Update(game, config.timeStep);
+        }
+
+        game.Update(config.timeStep);
+        elapsed += config.timeStep;
+
+        size_t liveNodes = game.GetNodeCount();
+        window.tickMilliseconds += game.GetUpdateMilliseconds();
+        windowNodeTicks += static_cast<double>(liveNodes);
+        windowTicks++;
+
+        if (elapsed >= (samples.size() + 1) * sampleInterval || elapsed >= config.maxDuration) {
+            window.simTime = elapsed;
+            window.liveNodes = liveNodes;
+            window.nanosecondsPerNode = windowNodeTicks > 0.0 ? window.tickMilliseconds * 1e6 / windowNodeTicks : 0.0;
+            window.tickMilliseconds /= windowTicks;
+            samples.push_back(window);
+
+            window = OverloadSample{};
+            windowTicks = 0;
+            windowNodeTicks = 0.0;
+        }
+    }
+
+    return samples;
+}
+
+Position BatchSimulator::ScriptedCursor(IGame& game, float elapsedTime) {
+    float centerX = game.GetScreenWidth() / 2.0f;
+    float centerY = game.GetScreenHeight() / 2.0f;
+    float radius = game.GetScreenHeight() * 0.2f;
+    float angle = elapsedTime * 1.2f;
+
+    return Position{centerX + std::cos(angle) * radius, centerY + std::sin(angle * 0.7f) * radius};
+}
+
+void BatchSimulator::ApplyUpgrades(IUpgradeService& upgradeService, const UpgradeConfig& upgrades) {
+    for (int i = 0; i < upgrades.healthUpgrades; ++i) {
+        upgradeService.BuyHealthUpgrade();
+    }
+    for (int i = 0; i < upgrades.regenUpgrades; ++i) {
+        upgradeService.BuyRegenUpgrade();
+    }
+    for (int i = 0; i < upgrades.damageZoneUpgrades; ++i) {
+        upgradeService.BuyDamageZoneUpgrade();
+    }
+    for (int i = 0; i < upgrades.damageUpgrades; ++i) {
+        upgradeService.BuyDamageUpgrade();
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "AutoPlayer.h"
+#include "Config/LevelTable.h"
+#include "Types/Position.h"
+#include "Types/SimulationReport.h"
+
+class IGame;
+class IUpgradeService;
+
+// Returns where the damage zone should be for the coming tick.
+using CursorPolicy = std::function<Position(IGame& game, float elapsedTime)>;
+
+struct BatchSimulationConfig {
+    std::vector<int> startLevels{1};
+    std::vector<UpgradeConfig> upgradeConfigs{UpgradeConfig{}};
+    int runsPerConfig = 16;
+    uint64_t baseSeed = 1;
+    float timeStep = 1.0f / 60.0f;
+    float maxDuration = 300.0f;
+    float screenWidth = 1920.0f;
+    float screenHeight = 1080.0f;
+    int histogramBuckets = 10;
+    size_t threadCount = 0;
+    LevelTable levelTable;
+    // When no cursor policy is given every run gets its own AutoPlayer.
+    CursorPolicy cursorPolicy;
+    AutoPlayerPolicy autoPlayerPolicy = AutoPlayerPolicy::Balanced;
+};
+
+// Runs many independent headless Game instances on a thread pool and
+// aggregates them per (start level, upgrade configuration) sweep cell.
+class BatchSimulator {
+   private:
+    BatchSimulationConfig m_Config;
+
+   public:
+    explicit BatchSimulator(BatchSimulationConfig config);
+
+    std::vector<SweepCellReport> Run();
+
+    static SimulationRunResult RunSingle(const BatchSimulationConfig& config, int startLevel,
+                                         const UpgradeConfig& upgrades, uint64_t seed);
+
+    // One Overload-mode run for config.maxDuration simulated seconds, timing every tick on the
+    // wall clock and averaging them over windows of sampleInterval simulated seconds. Crowd
+    // separation uses config.threadCount workers. Health never ends the run.
+    static std::vector<OverloadSample> RunOverload(const BatchSimulationConfig& config, uint64_t seed,
+                                                   float sampleInterval);
+
+    // Slow orbit around the screen center, independent of what is on screen.
+    static Position ScriptedCursor(IGame& game, float elapsedTime);
+
+   private:
+    static void ApplyUpgrades(IUpgradeService& upgradeService, const UpgradeConfig& upgrades);
+};
@@ -0,0 +1,186 @@
+#include "SimulationThread.h"
+
+#include <chrono>
+
+#include "AutoPlayer.h"
+#include "Config/GameConfig.h"
+#include "Events/GameEvents.h"
+#include "IGame.h"
+#include "Services/IHealthService.h"
+#include "Services/ILevelService.h"
+
+SimulationThread::EventRecorder::EventRecorder(std::vector<SnapshotEvent>& events)
+    : m_Events(events) {
+}
+
+void SimulationThread::EventRecorder::Update(const std::shared_ptr<IEvent>& event) {
+    auto gameEvent = std::static_pointer_cast<GameEvent>(event);
+    m_Events.push_back(SnapshotEvent{gameEvent->type, gameEvent->position});
+}
+
+SimulationThread::SimulationThread(IGame& game)
+    : m_Game(game),
+      m_Input(GameConfig::SIMULATION_INPUT_CAPACITY),
+      m_CarryOver(false),
+      m_Tick(0),
+      m_TickMilliseconds(0.0),
+      m_Paused(true),
+      m_Ticking(false),
+      m_Stopping(false) {
+    m_EventRecorder = std::make_shared<EventRecorder>(m_PendingEvents);
+    m_Game.Attach(m_EventRecorder);
+}
+
+SimulationThread::~SimulationThread() {
+    Stop();
+    m_Game.Detach(m_EventRecorder);
+}
+
+void SimulationThread::Start() {
+    if (m_Thread.joinable()) {
+        return;
+    }
+    m_Stopping = false;
+    m_Thread = std::thread(&SimulationThread::Run, this);
+}
+
+void SimulationThread::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_Condition.notify_all();
+    if (m_Thread.joinable()) {
+        m_Thread.join();
+    }
+}
+
+void SimulationThread::Pause() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Paused = true;
+    m_Condition.notify_all();
+    m_Condition.wait(lock, [this]() { return !m_Ticking; });
+}
+
+void SimulationThread::Resume() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    if (!m_Paused) {
+        return;
+    }
+    // Paused and not ticking: this thread owns the game and the writer side until unlock
+    Publish(false);
+    m_Paused = false;
+    m_Condition.notify_all();
+}
+
+bool SimulationThread::IsPaused() {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Paused;
+}
+
+void SimulationThread::SetAutoPlay(bool enabled) {
+    if (enabled) {
+        m_AutoPlayer = std::make_unique<AutoPlayer>();
+    } else {
+        m_AutoPlayer.reset();
+    }
+}
+
+bool SimulationThread::PushInput(const SimulationInput& input) {
+    return m_Input.TryPush(input);
+}
+
+bool SimulationThread::AcquireSnapshot() {
+    return m_Snapshots.Acquire();
+}
+
+const WorldSnapshot& SimulationThread::GetSnapshot() const {
+    return m_Snapshots.GetFront();
+}
+
+void SimulationThread::Run() {
+    using Clock = std::chrono::steady_clock;
+    const auto step = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float>(GameConfig::SIMULATION_TIME_STEP));
+    const auto maxLag = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<float>(GameConfig::SIMULATION_MAX_LAG));
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    auto nextTick = Clock::now();
+
+    while (!m_Stopping) {
+        if (m_Paused) {
+            m_Condition.wait(lock, [this]() { return !m_Paused || m_Stopping; });
+            nextTick = Clock::now();
+            continue;
+        }
+
+        m_Ticking = true;
+        lock.unlock();
+        bool needsAttention = Step(GameConfig::SIMULATION_TIME_STEP);
+        lock.lock();
+        m_Ticking = false;
+        m_Condition.notify_all();
+
+        if (needsAttention) {
+            m_Paused = true;
+            continue;
+        }
+
+        // Fixed steps keep the game independent of the frame rate; after a long stall
+        // (a debugger, a dragged window) the clock skips ahead instead of racing to catch up
+        nextTick += step;
+        auto now = Clock::now();
+        if (now - nextTick > maxLag) {
+            nextTick = now;
+        }
+        m_Condition.wait_until(lock, nextTick, [this]() { return m_Paused || m_Stopping; });
+    }
+}
+
+bool SimulationThread::Step(float deltaTime) {
+    SimulationInput input;
+    bool hasInput = false;
+    while (m_Input.TryPop(input)) {
+        hasInput = true;
+    }
+
+    if (m_AutoPlayer) {
+        m_AutoPlayer->Update(m_Game, deltaTime);
+    } else if (hasInput) {
+        m_Game.SetMousePosition(input.cursorX, input.cursorY);
+    }
+
+    m_Game.Update(deltaTime);
+    m_TickMilliseconds = m_Game.GetUpdateMilliseconds();
+    m_Tick++;
+
+    Publish(true);
+
+    return m_Game.GetHealthService().IsZero() || m_Game.GetLevelService().IsLevelCompleted();
+}
+
+void SimulationThread::Publish(bool newTick) {
+    WorldSnapshot& snapshot = m_Snapshots.GetBack();
+    // A snapshot the reader never took still holds events and pickups it has not seen
+    m_CarriedPickups.clear();
+    if (m_CarryOver) {
+        m_CarriedPickups.swap(snapshot.collectedPickups);
+    } else {
+        snapshot.events.clear();
+    }
+
+    m_Game.CaptureSnapshot(snapshot);
+    snapshot.tick = m_Tick;
+    snapshot.tickMilliseconds = m_TickMilliseconds;
+
+    // Collections belong to the tick that made them, not to a republish of it
+    if (!newTick) {
+        snapshot.collectedPickups.clear();
+    }
+    snapshot.collectedPickups.insert(snapshot.collectedPickups.begin(), m_CarriedPickups.begin(), m_CarriedPickups.end());
+    snapshot.events.insert(snapshot.events.end(), m_PendingEvents.begin(), m_PendingEvents.end());
+    m_PendingEvents.clear();
+
+    m_CarryOver = m_Snapshots.Publish();
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Events/IObserver.h"
+#include "SpscQueue.h"
+#include "TripleBuffer.h"
+#include "Types/WorldSnapshot.h"
+
+class AutoPlayer;
+class IGame;
+
+struct SimulationInput {
+    float cursorX;
+    float cursorY;
+};
+
+// Steps a game at a fixed rate on its own thread so simulation and drawing overlap.
+// Each tick publishes a WorldSnapshot through a triple buffer; the render thread draws the
+// newest one and sends the cursor back through a queue, so neither side waits on the other.
+//
+// The game may only be touched directly while the thread is paused. Pause() returns once the
+// current tick is done, and the thread pauses itself when health runs out or the level ends.
+class SimulationThread {
+   private:
+    class EventRecorder : public IObserver {
+       private:
+        std::vector<SnapshotEvent>& m_Events;
+
+       public:
+        explicit EventRecorder(std::vector<SnapshotEvent>& events);
+        void Update(const std::shared_ptr<IEvent>& event) override;
+    };
+
+    IGame& m_Game;
+    TripleBuffer<WorldSnapshot> m_Snapshots;
+    SpscQueue<SimulationInput> m_Input;
+    // Events arrive on whichever thread is driving the game; the pause hand-over orders them
+    std::vector<SnapshotEvent> m_PendingEvents;
+    std::vector<PickupSnapshot> m_CarriedPickups;
+    std::shared_ptr<EventRecorder> m_EventRecorder;
+    std::unique_ptr<AutoPlayer> m_AutoPlayer;
+    bool m_CarryOver;
+    uint64_t m_Tick;
+    double m_TickMilliseconds;
+
+    std::thread m_Thread;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_Paused;
+    bool m_Ticking;
+    bool m_Stopping;
+
+   public:
+    explicit SimulationThread(IGame& game);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    // The thread starts paused.
+    void Start();
+    void Stop();
+    void Pause();
+    // Publishes the current state first, so the frame after a Reset never shows the old run.
+    void Resume();
+    bool IsPaused();
+
+    // Lets the built-in bot steer the damage zone from the simulation thread. Call while paused.
+    void SetAutoPlay(bool enabled);
+
+    // Render thread side
+    bool PushInput(const SimulationInput& input);
+    bool AcquireSnapshot();
+    const WorldSnapshot& GetSnapshot() const;
+
+   private:
+    void Run();
+    // Returns true when the game reached a state the UI has to handle first.
+    bool Step(float deltaTime);
+    void Publish(bool newTick);
+};
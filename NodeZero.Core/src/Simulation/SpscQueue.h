@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+// Capacity is rounded up to a power of two; TryPush fails instead of waiting when full.
+template <typename T>
+class SpscQueue {
+   private:
+    std::vector<T> m_Slots;
+    size_t m_Mask;
+    // Head is written only by the consumer and tail only by the producer
+    alignas(64) std::atomic<size_t> m_Head;
+    alignas(64) std::atomic<size_t> m_Tail;
+
+   public:
+    explicit SpscQueue(size_t capacity)
+        : m_Head(0), m_Tail(0) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_Slots.resize(size);
+        m_Mask = size - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    bool TryPush(const T& value) {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_Head.load(std::memory_order_acquire) == m_Slots.size()) {
+            return false;
+        }
+        m_Slots[tail & m_Mask] = value;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& value) {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_Tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = m_Slots[head & m_Mask];
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t GetCapacity() const {
+        return m_Slots.size();
+    }
+};
@@ -0,0 +1,149 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+ThreadPool::ThreadPool(size_t threadCount)
+    : m_ActiveTasks(0),
+      m_Stopping(false) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_Workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_Workers.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_TaskAvailable.notify_all();
+
+    for (std::thread& worker : m_Workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::Submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Tasks.push(std::move(task));
+    }
+    m_TaskAvailable.notify_one();
+}
+
+void ThreadPool::WaitIdle() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_Idle.wait(lock, [this]() { return m_Tasks.empty() && m_ActiveTasks == 0; });
+
+    if (m_Error) {
+        std::exception_ptr error = m_Error;
+        m_Error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::ParallelFor(size_t count, size_t chunkSize, const std::function<void(size_t, size_t)>& body) {
+    chunkSize = std::max<size_t>(1, chunkSize);
+    size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    if (chunkCount <= 1 || m_Workers.empty()) {
+        if (count > 0) {
+            body(0, count);
+        }
+        return;
+    }
+
+    struct Progress {
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> finishedChunks{0};
+        std::atomic<bool> failed{false};
+        std::mutex mutex;
+        std::condition_variable allFinished;
+        std::exception_ptr error;
+    };
+    auto progress = std::make_shared<Progress>();
+
+    // Helpers that start after the last chunk was claimed return without touching body
+    auto runChunks = [progress, chunkCount, chunkSize, count, &body]() {
+        size_t chunk;
+        while ((chunk = progress->nextChunk.fetch_add(1)) < chunkCount) {
+            // Chunks after a failure are still counted so the wait below ends
+            if (!progress->failed.load()) {
+                try {
+                    size_t begin = chunk * chunkSize;
+                    body(begin, std::min(count, begin + chunkSize));
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(progress->mutex);
+                    if (!progress->error) {
+                        progress->error = std::current_exception();
+                    }
+                    progress->failed.store(true);
+                }
+            }
+
+            if (progress->finishedChunks.fetch_add(1) + 1 == chunkCount) {
+                std::lock_guard<std::mutex> lock(progress->mutex);
+                progress->allFinished.notify_all();
+            }
+        }
+    };
+
+    size_t helpers = std::min(chunkCount - 1, m_Workers.size());
+    for (size_t i = 0; i < helpers; ++i) {
+        Submit(runChunks);
+    }
+    runChunks();
+
+    std::unique_lock<std::mutex> lock(progress->mutex);
+    progress->allFinished.wait(lock, [&progress, chunkCount]() {
+        return progress->finishedChunks.load() == chunkCount;
+    });
+    if (progress->error) {
+        std::rethrow_exception(progress->error);
+    }
+}
+
+size_t ThreadPool::GetThreadCount() const {
+    return m_Workers.size();
+}
+
+void ThreadPool::WorkerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_TaskAvailable.wait(lock, [this]() { return m_Stopping || !m_Tasks.empty(); });
+
+            if (m_Stopping && m_Tasks.empty()) {
+                return;
+            }
+
+            task = std::move(m_Tasks.front());
+            m_Tasks.pop();
+            m_ActiveTasks++;
+        }
+
+        std::exception_ptr error;
+        try {
+            task();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (error && !m_Error) {
+                m_Error = error;
+            }
+            m_ActiveTasks--;
+            if (m_Tasks.empty() && m_ActiveTasks == 0) {
+                m_Idle.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+   private:
+    std::vector<std::thread> m_Workers;
+    std::queue<std::function<void()>> m_Tasks;
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    std::condition_variable m_Idle;
+    size_t m_ActiveTasks;
+    bool m_Stopping;
+    // First exception thrown by a submitted task since the last WaitIdle
+    std::exception_ptr m_Error;
+
+   public:
+    // threadCount == 0 uses one worker per hardware thread.
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // A task that throws does not end its worker; the exception is kept for WaitIdle.
+    void Submit(std::function<void()> task);
+    // Rethrows the first exception a task threw since the previous call, once all are done.
+    void WaitIdle();
+
+    // Runs body(begin, end) over [0, count) in chunks of chunkSize and returns once every
+    // chunk is done. The calling thread takes chunks too, so this is safe to call from
+    // inside a task and does not wait for unrelated work. If body throws, the chunks not yet
+    // started are skipped and the first exception is rethrown here once the rest have finished.
+    void ParallelFor(size_t count, size_t chunkSize, const std::function<void(size_t, size_t)>& body);
+
+    size_t GetThreadCount() const;
+
+   private:
+    void WorkerLoop();
+};
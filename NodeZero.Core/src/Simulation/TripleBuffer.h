@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Hands the newest value from one writer thread to one reader thread without locks.
+// The writer fills GetBack() and publishes it; the reader takes whatever was published
+// last and reads GetFront() until it takes another. Neither side ever waits, and values
+// the reader was too slow to see are overwritten rather than queued.
+template <typename T>
+class TripleBuffer {
+   private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t FRESH = 0x4;
+
+    std::array<T, 3> m_Buffers;
+    // Index of the buffer between the two sides, plus FRESH while the reader has not taken it
+    alignas(64) std::atomic<uint8_t> m_Middle;
+    alignas(64) uint8_t m_Back;
+    alignas(64) uint8_t m_Front;
+
+   public:
+    TripleBuffer()
+        : m_Middle(1), m_Back(0), m_Front(2) {
+    }
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Writer side. The back buffer keeps whatever it held when it was last swapped in.
+    T& GetBack() {
+        return m_Buffers[m_Back];
+    }
+
+    // Returns true when the value this replaces was never taken, in which case the new
+    // back buffer is that unseen value.
+    bool Publish() {
+        uint8_t previous = m_Middle.exchange(static_cast<uint8_t>(m_Back | FRESH), std::memory_order_acq_rel);
+        m_Back = previous & INDEX_MASK;
+        return (previous & FRESH) != 0;
+    }
+
+    // Reader side. Returns false, keeping the current front, when nothing new was published.
+    bool Acquire() {
+        if ((m_Middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+            return false;
+        }
+        uint8_t previous = m_Middle.exchange(m_Front, std::memory_order_acq_rel);
+        m_Front = previous & INDEX_MASK;
+        return true;
+    }
+
+    const T& GetFront() const {
+        return m_Buffers[m_Front];
+    }
+};
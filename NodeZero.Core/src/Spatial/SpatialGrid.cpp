@@ -0,0 +1,89 @@
+#include "SpatialGrid.h"
+
+#include <cmath>
+
+// Keeps the cell array bounded when a few points are far away from the rest.
+static constexpr int MAX_CELLS_PER_AXIS = 256;
+
+SpatialGrid::SpatialGrid()
+    : m_CellSize(1.0f),
+      m_InvCellSize(1.0f),
+      m_OriginX(0.0f),
+      m_OriginY(0.0f),
+      m_Columns(0),
+      m_Rows(0) {
+}
+
+void SpatialGrid::Build(const float* xs, const float* ys, size_t count, float cellSize) {
+    m_Entries.clear();
+    m_EntryCell.clear();
+    m_CellStart.clear();
+    m_Columns = 0;
+    m_Rows = 0;
+
+    if (count == 0) {
+        return;
+    }
+
+    float minX = xs[0];
+    float maxX = xs[0];
+    float minY = ys[0];
+    float maxY = ys[0];
+    for (size_t i = 1; i < count; ++i) {
+        minX = std::min(minX, xs[i]);
+        maxX = std::max(maxX, xs[i]);
+        minY = std::min(minY, ys[i]);
+        maxY = std::max(maxY, ys[i]);
+    }
+
+    float extent = std::max(maxX - minX, maxY - minY);
+    m_CellSize = std::max(cellSize, extent / MAX_CELLS_PER_AXIS);
+    m_CellSize = std::max(m_CellSize, 1.0f);
+    m_InvCellSize = 1.0f / m_CellSize;
+    m_OriginX = minX;
+    m_OriginY = minY;
+    m_Columns = CellCoord(maxX - minX) + 1;
+    m_Rows = CellCoord(maxY - minY) + 1;
+
+    size_t cellCount = static_cast<size_t>(m_Columns) * m_Rows;
+    m_CellStart.assign(cellCount + 1, 0);
+    m_EntryCell.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        int column = std::min(m_Columns - 1, CellCoord(xs[i] - m_OriginX));
+        int row = std::min(m_Rows - 1, CellCoord(ys[i] - m_OriginY));
+        uint32_t cell = static_cast<uint32_t>(row * m_Columns + column);
+        m_EntryCell[i] = cell;
+        m_CellStart[cell + 1]++;
+    }
+
+    for (size_t cell = 0; cell < cellCount; ++cell) {
+        m_CellStart[cell + 1] += m_CellStart[cell];
+    }
+
+    m_Entries.resize(count);
+    m_WriteCursor.assign(m_CellStart.begin(), m_CellStart.end() - 1);
+    for (size_t i = 0; i < count; ++i) {
+        m_Entries[m_WriteCursor[m_EntryCell[i]]++] = static_cast<uint32_t>(i);
+    }
+}
+
+void SpatialGrid::Clear() {
+    m_Entries.clear();
+    m_EntryCell.clear();
+    m_CellStart.clear();
+    m_Columns = 0;
+    m_Rows = 0;
+}
+
+size_t SpatialGrid::GetCount() const {
+    return m_Entries.size();
+}
+
+float SpatialGrid::GetCellSize() const {
+    return m_CellSize;
+}
+
+int SpatialGrid::CellCoord(float offset) const {
+    return static_cast<int>(std::floor(offset * m_InvCellSize));
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Uniform grid over a set of points, rebuilt from scratch whenever the points move.
+// Entries are stored per cell in one contiguous array (counting sort), so a rebuild
+// is two linear passes and a query touches only the cells overlapping its rectangle.
+class SpatialGrid {
+   private:
+    float m_CellSize;
+    float m_InvCellSize;
+    float m_OriginX;
+    float m_OriginY;
+    int m_Columns;
+    int m_Rows;
+    std::vector<uint32_t> m_CellStart;
+    std::vector<uint32_t> m_Entries;
+    std::vector<uint32_t> m_EntryCell;
+    std::vector<uint32_t> m_WriteCursor;
+
+   public:
+    SpatialGrid();
+
+    // Points are identified by their index in the input arrays.
+    void Build(const float* xs, const float* ys, size_t count, float cellSize);
+    void Clear();
+
+    size_t GetCount() const;
+    float GetCellSize() const;
+
+    // Calls fn(index) for every point in cells overlapping the rectangle. Points near the
+    // rectangle border may be reported; callers do their own exact test.
+    template <typename Fn>
+    void QueryRect(float minX, float minY, float maxX, float maxY, Fn&& fn) const {
+        if (m_Entries.empty()) {
+            return;
+        }
+
+        int firstColumn = std::max(0, CellCoord(minX - m_OriginX));
+        int lastColumn = std::min(m_Columns - 1, CellCoord(maxX - m_OriginX));
+        int firstRow = std::max(0, CellCoord(minY - m_OriginY));
+        int lastRow = std::min(m_Rows - 1, CellCoord(maxY - m_OriginY));
+
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                size_t cell = static_cast<size_t>(row) * m_Columns + column;
+                for (uint32_t i = m_CellStart[cell]; i < m_CellStart[cell + 1]; ++i) {
+                    fn(m_Entries[i]);
+                }
+            }
+        }
+    }
+
+    template <typename Fn>
+    void QueryRadius(float x, float y, float radius, Fn&& fn) const {
+        QueryRect(x - radius, y - radius, x + radius, y + radius, fn);
+    }
+
+    // Visits the other points in point index's own cell, then in the eight cells around it,
+    // until fn(other) has returned true maxResults times. With a cell size at least the
+    // largest interaction distance this covers every neighbor a capped query should prefer.
+    template <typename Fn>
+    void QueryNeighbors(uint32_t index, size_t maxResults, Fn&& fn) const {
+        if (index >= m_EntryCell.size() || maxResults == 0) {
+            return;
+        }
+
+        uint32_t ownCell = m_EntryCell[index];
+        int ownColumn = static_cast<int>(ownCell % m_Columns);
+        int ownRow = static_cast<int>(ownCell / m_Columns);
+        size_t found = 0;
+
+        auto visitCell = [&](size_t cell) {
+            for (uint32_t i = m_CellStart[cell]; i < m_CellStart[cell + 1]; ++i) {
+                uint32_t other = m_Entries[i];
+                if (other != index && fn(other) && ++found >= maxResults) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        if (visitCell(ownCell)) {
+            return;
+        }
+
+        for (int row = std::max(0, ownRow - 1); row <= std::min(m_Rows - 1, ownRow + 1); ++row) {
+            for (int column = std::max(0, ownColumn - 1); column <= std::min(m_Columns - 1, ownColumn + 1); ++column) {
+                size_t cell = static_cast<size_t>(row) * m_Columns + column;
+                if (cell != ownCell && visitCell(cell)) {
+                    return;
+                }
+            }
+        }
+    }
+
+   private:
+    int CellCoord(float offset) const;
+};
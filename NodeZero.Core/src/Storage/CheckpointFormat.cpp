@@ -0,0 +1,93 @@
+#include "CheckpointFormat.h"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace CheckpointFormat {
+
+namespace {
+
+static_assert(std::is_trivially_copyable<Header>::value, "checkpoint header is stored byte for byte");
+static_assert(std::is_trivially_copyable<NodeCheckpoint>::value, "node records are stored byte for byte");
+static_assert(std::is_trivially_copyable<PointPickup>::value, "pickup records are stored byte for byte");
+
+constexpr size_t CHECKSUM_START = offsetof(Header, nodeCount);
+
+size_t AlignUp(size_t offset) {
+    return (offset + 7) & ~static_cast<size_t>(7);
+}
+
+// FNV-1a, 64-bit
+uint64_t Checksum(const uint8_t* data, size_t size) {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+}  // namespace
+
+void Write(const Checkpoint& checkpoint, std::vector<uint8_t>& bytes) {
+    // Zeroed whole, padding included, so equal checkpoints give equal files
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.nodeCount = static_cast<uint32_t>(checkpoint.nodes.size());
+    header.pickupCount = static_cast<uint32_t>(checkpoint.pickups.size());
+    header.nodeOffset = AlignUp(sizeof(Header));
+    header.pickupOffset = AlignUp(header.nodeOffset + checkpoint.nodes.size() * sizeof(NodeCheckpoint));
+    header.fileSize = header.pickupOffset + checkpoint.pickups.size() * sizeof(PointPickup);
+    header.world = checkpoint.world;
+
+    bytes.assign(static_cast<size_t>(header.fileSize), 0);
+    if (!checkpoint.nodes.empty()) {
+        std::memcpy(bytes.data() + header.nodeOffset, checkpoint.nodes.data(),
+                    checkpoint.nodes.size() * sizeof(NodeCheckpoint));
+    }
+    if (!checkpoint.pickups.empty()) {
+        std::memcpy(bytes.data() + header.pickupOffset, checkpoint.pickups.data(),
+                    checkpoint.pickups.size() * sizeof(PointPickup));
+    }
+
+    // Checksummed in place so the padding between sections is covered as written
+    std::memcpy(bytes.data(), &header, sizeof(Header));
+    header.checksum = Checksum(bytes.data() + CHECKSUM_START, bytes.size() - CHECKSUM_START);
+    std::memcpy(bytes.data() + offsetof(Header, checksum), &header.checksum, sizeof(header.checksum));
+}
+
+bool Read(const uint8_t* data, size_t size, Checkpoint& checkpoint) {
+    if (!data || size < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION || header.fileSize != size) {
+        return false;
+    }
+    if (header.nodeOffset < sizeof(Header) ||
+        header.nodeOffset + static_cast<uint64_t>(header.nodeCount) * sizeof(NodeCheckpoint) > header.pickupOffset ||
+        header.pickupOffset + static_cast<uint64_t>(header.pickupCount) * sizeof(PointPickup) > size) {
+        return false;
+    }
+    if (Checksum(data + CHECKSUM_START, size - CHECKSUM_START) != header.checksum) {
+        return false;
+    }
+
+    checkpoint.world = header.world;
+    checkpoint.nodes.resize(header.nodeCount);
+    if (header.nodeCount > 0) {
+        std::memcpy(checkpoint.nodes.data(), data + header.nodeOffset, header.nodeCount * sizeof(NodeCheckpoint));
+    }
+    checkpoint.pickups.resize(header.pickupCount);
+    if (header.pickupCount > 0) {
+        std::memcpy(checkpoint.pickups.data(), data + header.pickupOffset, header.pickupCount * sizeof(PointPickup));
+    }
+    return true;
+}
+
+}  // namespace CheckpointFormat
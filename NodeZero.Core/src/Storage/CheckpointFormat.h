@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Types/Checkpoint.h"
+
+// On-disk layout of a checkpoint: a fixed header holding the WorldCheckpoint, then the
+// node and pickup records as flat arrays at 8-byte aligned offsets. A mapped file can be
+// read in place; the checksum covers everything after itself, so a torn write is refused.
+namespace CheckpointFormat {
+
+constexpr uint32_t MAGIC = 0x50435A4E;  // "NZCP"
+constexpr uint32_t VERSION = 3;
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t fileSize;
+    uint64_t checksum;
+    uint32_t nodeCount;
+    uint32_t pickupCount;
+    uint64_t nodeOffset;
+    uint64_t pickupOffset;
+    WorldCheckpoint world;
+};
+
+void Write(const Checkpoint& checkpoint, std::vector<uint8_t>& bytes);
+bool Read(const uint8_t* data, size_t size, Checkpoint& checkpoint);
+
+}  // namespace CheckpointFormat
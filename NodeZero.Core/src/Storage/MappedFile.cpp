@@ -0,0 +1,228 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : m_Data(nullptr),
+      m_Size(0),
+      m_Writable(false),
+#ifdef _WIN32
+      m_File(nullptr),
+      m_Mapping(nullptr)
+#else
+      m_Descriptor(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    m_File = file;
+    m_Mapping = mapping;
+    m_Data = static_cast<uint8_t*>(data);
+    m_Size = static_cast<size_t>(size.QuadPart);
+#else
+    int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || status.st_size <= 0) {
+        close(descriptor);
+        return false;
+    }
+    void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // The mapping keeps the file alive on its own
+    close(descriptor);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    m_Data = static_cast<uint8_t*>(data);
+    m_Size = static_cast<size_t>(status.st_size);
+#endif
+    return true;
+}
+
+bool MappedFile::OpenWritable(const std::string& path) {
+    Close();
+
+    size_t size = 0;
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    m_File = file;
+    size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int descriptor = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (descriptor < 0) {
+        return false;
+    }
+    struct stat status;
+    if (fstat(descriptor, &status) != 0) {
+        close(descriptor);
+        return false;
+    }
+    m_Descriptor = descriptor;
+    size = static_cast<size_t>(status.st_size);
+#endif
+    m_Writable = true;
+
+    if (size > 0 && !MapWritable(size)) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::Resize(size_t size) {
+    if (!m_Writable) {
+        return false;
+    }
+    size_t oldSize = m_Size;
+    Unmap();
+    if (SetLength(size) && (size == 0 || MapWritable(size))) {
+        return true;
+    }
+
+    // Put the old mapping back so the caller still has its data
+    if (SetLength(oldSize) && oldSize > 0) {
+        MapWritable(oldSize);
+    }
+    return false;
+}
+
+void MappedFile::Flush() {
+    if (!m_Data || !m_Writable) {
+        return;
+    }
+#ifdef _WIN32
+    FlushViewOfFile(m_Data, 0);
+#else
+    msync(m_Data, m_Size, MS_ASYNC);
+#endif
+}
+
+void MappedFile::Close() {
+    Unmap();
+#ifdef _WIN32
+    if (m_File) {
+        CloseHandle(m_File);
+        m_File = nullptr;
+    }
+#else
+    if (m_Descriptor >= 0) {
+        close(m_Descriptor);
+        m_Descriptor = -1;
+    }
+#endif
+    m_Writable = false;
+}
+
+bool MappedFile::SetLength(size_t size) {
+#ifdef _WIN32
+    // The view and mapping are gone by now, so the end of the file can move
+    LARGE_INTEGER end;
+    end.QuadPart = static_cast<LONGLONG>(size);
+    return SetFilePointerEx(m_File, end, NULL, FILE_BEGIN) && SetEndOfFile(m_File);
+#else
+    return ftruncate(m_Descriptor, static_cast<off_t>(size)) == 0;
+#endif
+}
+
+bool MappedFile::MapWritable(size_t size) {
+#ifdef _WIN32
+    uint64_t wide = static_cast<uint64_t>(size);
+    HANDLE mapping = CreateFileMappingA(m_File, NULL, PAGE_READWRITE, static_cast<DWORD>(wide >> 32),
+                                        static_cast<DWORD>(wide & 0xFFFFFFFFu), NULL);
+    if (mapping == NULL) {
+        return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return false;
+    }
+    m_Mapping = mapping;
+#else
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_Descriptor, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+#endif
+    m_Data = static_cast<uint8_t*>(data);
+    m_Size = size;
+    return true;
+}
+
+void MappedFile::Unmap() {
+    if (!m_Data) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(m_Data);
+    CloseHandle(m_Mapping);
+    m_Mapping = nullptr;
+#else
+    munmap(m_Data, m_Size);
+#endif
+    m_Data = nullptr;
+    m_Size = 0;
+}
+
+bool MappedFile::IsOpen() const {
+    return m_Data != nullptr || m_Writable;
+}
+
+const uint8_t* MappedFile::GetData() const {
+    return m_Data;
+}
+
+uint8_t* MappedFile::GetMutableData() {
+    return m_Writable ? m_Data : nullptr;
+}
+
+size_t MappedFile::GetSize() const {
+    return m_Size;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// A whole file mapped into memory. Pages are read in on first touch, so opening a large file
+// costs nothing until its bytes are used. Open maps it read-only; OpenWritable maps it shared,
+// so stores go straight to the file, and lets it grow with Resize.
+class MappedFile {
+   private:
+    uint8_t* m_Data;
+    size_t m_Size;
+    bool m_Writable;
+#ifdef _WIN32
+    void* m_File;
+    void* m_Mapping;
+#else
+    // Only kept open for writable files, which are remapped on Resize
+    int m_Descriptor;
+#endif
+
+   public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Returns false when the file is missing, empty or cannot be mapped.
+    bool Open(const std::string& path);
+    // Creates the file when missing. An empty file opens with no data until it is resized.
+    bool OpenWritable(const std::string& path);
+    // Grows or shrinks a writable file to size bytes and maps all of it; new bytes read as
+    // zero. Pointers from GetData and GetMutableData are invalid afterwards. On failure the
+    // previous mapping is put back where the system allows.
+    bool Resize(size_t size);
+    // Asks the system to write dirty pages back without waiting for it.
+    void Flush();
+    void Close();
+
+    bool IsOpen() const;
+    const uint8_t* GetData() const;
+    // Null unless the file was opened writable.
+    uint8_t* GetMutableData();
+    size_t GetSize() const;
+
+   private:
+    bool SetLength(size_t size);
+    bool MapWritable(size_t size);
+    void Unmap();
+};
@@ -0,0 +1,54 @@
+#include "RunHistoryFormat.h"
+
+#include <cstring>
+
+namespace RunHistoryFormat {
+
+size_t Bucket(uint32_t value) {
+    if (value < EXACT_BUCKETS) {
+        return value;
+    }
+    size_t exponent = 6;
+    while ((value >> (exponent + 1)) != 0) {
+        exponent++;
+    }
+    size_t sub = (value >> (exponent - 4)) & (SUB_BUCKETS - 1);
+    return EXACT_BUCKETS + (exponent - 6) * SUB_BUCKETS + sub;
+}
+
+double BucketValue(size_t bucket) {
+    if (bucket < EXACT_BUCKETS) {
+        return static_cast<double>(bucket);
+    }
+    size_t exponent = 6 + (bucket - EXACT_BUCKETS) / SUB_BUCKETS;
+    size_t sub = (bucket - EXACT_BUCKETS) % SUB_BUCKETS;
+    double width = static_cast<double>(uint64_t{1} << (exponent - 4));
+    return static_cast<double>(SUB_BUCKETS + sub) * width + (width - 1.0) * 0.5;
+}
+
+void Initialize(Header& header) {
+    std::memset(&header, 0, sizeof(Header));
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.columnCount = static_cast<uint32_t>(COLUMN_COUNT);
+    header.blockRuns = static_cast<uint32_t>(BLOCK_RUNS);
+}
+
+bool IsValid(const uint8_t* data, size_t size) {
+    if (!data || size < HEADER_BYTES) {
+        return false;
+    }
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != MAGIC || header.version != VERSION || header.columnCount != COLUMN_COUNT ||
+        header.blockRuns != BLOCK_RUNS) {
+        return false;
+    }
+    // Compared in blocks so a garbage count cannot overflow the size
+    if (header.blockCount > (size - HEADER_BYTES) / BLOCK_BYTES) {
+        return false;
+    }
+    return header.runCount <= header.blockCount * BLOCK_RUNS;
+}
+
+}  // namespace RunHistoryFormat
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// On-disk layout of the run history. A header holds the run count and one histogram per
+// column; runs follow in blocks of BLOCK_RUNS, and inside a block each column is its own
+// array of values followed by the running totals of that column from the first run. A block
+// is only ever appended, so growing the file never moves a stored run.
+namespace RunHistoryFormat {
+
+constexpr uint32_t MAGIC = 0x48525A4E;  // "NZRH"
+constexpr uint32_t VERSION = 1;
+
+constexpr size_t COLUMN_COUNT = 5;
+constexpr size_t BLOCK_RUNS = 1024;
+// Values below 64 have a bucket each; above, every power of two is split into 16
+constexpr size_t EXACT_BUCKETS = 64;
+constexpr size_t SUB_BUCKETS = 16;
+constexpr size_t HISTOGRAM_BUCKETS = EXACT_BUCKETS + 26 * SUB_BUCKETS;
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t columnCount;
+    uint32_t blockRuns;
+    uint64_t runCount;
+    uint64_t blockCount;
+    uint32_t histograms[COLUMN_COUNT][HISTOGRAM_BUCKETS];
+};
+
+// Rounded up to a page so the blocks start page-aligned
+constexpr size_t HEADER_BYTES = 16384;
+constexpr size_t BLOCK_BYTES = BLOCK_RUNS * COLUMN_COUNT * (sizeof(uint32_t) + sizeof(uint64_t));
+
+static_assert(sizeof(Header) <= HEADER_BYTES, "the header fits its reserved space");
+
+constexpr size_t ValueOffset(size_t column, size_t run) {
+    return HEADER_BYTES + (run / BLOCK_RUNS) * BLOCK_BYTES + column * BLOCK_RUNS * sizeof(uint32_t) +
+           (run % BLOCK_RUNS) * sizeof(uint32_t);
+}
+
+constexpr size_t TotalOffset(size_t column, size_t run) {
+    return HEADER_BYTES + (run / BLOCK_RUNS) * BLOCK_BYTES + COLUMN_COUNT * BLOCK_RUNS * sizeof(uint32_t) +
+           column * BLOCK_RUNS * sizeof(uint64_t) + (run % BLOCK_RUNS) * sizeof(uint64_t);
+}
+
+constexpr size_t FileSize(uint64_t blockCount) {
+    return HEADER_BYTES + static_cast<size_t>(blockCount) * BLOCK_BYTES;
+}
+
+size_t Bucket(uint32_t value);
+// Middle of the values that fall in bucket
+double BucketValue(size_t bucket);
+
+// Fills in a fresh header for an empty history.
+void Initialize(Header& header);
+// Checks that data holds a history in this layout with every block it counts.
+bool IsValid(const uint8_t* data, size_t size);
+
+}  // namespace RunHistoryFormat
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <string>
+
+// Full path of fileName in the per-user NodeZero data directory, which is created if missing.
+// Falls back to the working directory when there is no user directory.
+std::string GetSaveFilePath(const char* fileName);
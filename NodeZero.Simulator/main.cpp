@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Simulation/BatchSimulator.h"
+
+static std::vector<int> ParseLevels(const std::string& text) {
+    std::vector<int> levels;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            levels.push_back(std::max(1, std::atoi(item.c_str())));
+        }
+    }
+    return levels;
+}
+
+// Upgrade configurations are written as health:regen:zone:damage, separated by commas.
+static std::vector<UpgradeConfig> ParseUpgrades(const std::string& text) {
+    std::vector<UpgradeConfig> configs;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        UpgradeConfig config;
+        if (std::sscanf(item.c_str(), "%d:%d:%d:%d", &config.healthUpgrades, &config.regenUpgrades,
+                        &config.damageZoneUpgrades, &config.damageUpgrades) == 4) {
+            configs.push_back(config);
+        }
+    }
+    return configs;
+}
+
+static bool ParseCursor(const std::string& text, BatchSimulationConfig& config) {
+    if (text == "bot") {
+        config.autoPlayerPolicy = AutoPlayerPolicy::Balanced;
+    } else if (text == "hp") {
+        config.autoPlayerPolicy = AutoPlayerPolicy::MostHPInZone;
+    } else if (text == "pickups") {
+        config.autoPlayerPolicy = AutoPlayerPolicy::NearestPickupCluster;
+    } else if (text == "orbit") {
+        config.cursorPolicy = BatchSimulator::ScriptedCursor;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static void PrintHistogram(const char* name, const Histogram& histogram) {
+    std::printf("    %-16s mean %9.2f  p50 %9.2f  p90 %9.2f  [%g .. %g]  |", name, histogram.mean, histogram.median,
+                histogram.p90, histogram.minValue, histogram.maxValue);
+    for (int count : histogram.buckets) {
+        std::printf(" %d", count);
+    }
+    std::printf("\n");
+}
+
+static void PrintUsage() {
+    std::printf(
+        "Usage: NodeZeroSim [options]\n"
+        "  --runs N           runs per sweep cell (default 16)\n"
+        "  --threads N        worker threads, 0 = all cores (default 0)\n"
+        "  --levels L1,L2     start levels to sweep (default 1)\n"
+        "  --upgrades H:R:Z:D,...  upgrade purchases to sweep (default 0:0:0:0)\n"
+        "  --duration S       max simulated seconds per run (default 300)\n"
+        "  --seed S           base RNG seed (default 1)\n"
+        "  --cursor MODE      bot, hp, pickups or orbit (default bot)\n"
+        "  --level-table F    per-level difficulty overrides\n"
+        "  --overload         one Overload-mode run for --duration seconds, printing the\n"
+        "                     tick cost per live node every 5 simulated seconds\n");
+}
+
+int main(int argc, char** argv) {
+    BatchSimulationConfig config;
+    bool overload = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--runs" && hasValue) {
+            config.runsPerConfig = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--threads" && hasValue) {
+            config.threadCount = static_cast<size_t>(std::max(0, std::atoi(argv[++i])));
+        } else if (arg == "--levels" && hasValue) {
+            config.startLevels = ParseLevels(argv[++i]);
+        } else if (arg == "--upgrades" && hasValue) {
+            config.upgradeConfigs = ParseUpgrades(argv[++i]);
+        } else if (arg == "--duration" && hasValue) {
+            config.maxDuration = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--seed" && hasValue) {
+            config.baseSeed = std::strtoull(argv[++i], nullptr, 10);
+        } else if (arg == "--overload") {
+            overload = true;
+        } else if (arg == "--level-table" && hasValue && config.levelTable.LoadFromFile(argv[i + 1])) {
+            ++i;
+        } else if (arg == "--cursor" && hasValue && ParseCursor(argv[i + 1], config)) {
+            ++i;
+        } else {
+            PrintUsage();
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    if (config.startLevels.empty() || config.upgradeConfigs.empty()) {
+        PrintUsage();
+        return 1;
+    }
+
+    if (overload) {
+        std::printf("%8s %10s %12s %14s\n", "time (s)", "nodes", "tick (ms)", "ns per node");
+        for (const OverloadSample& sample : BatchSimulator::RunOverload(config, config.baseSeed, 5.0f)) {
+            std::printf("%8.1f %10zu %12.3f %14.1f\n", sample.simTime, sample.liveNodes, sample.tickMilliseconds,
+                        sample.nanosecondsPerNode);
+        }
+        return 0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    BatchSimulator simulator(config);
+    std::vector<SweepCellReport> reports = simulator.Run();
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - start;
+
+    size_t totalRuns = 0;
+    for (const SweepCellReport& report : reports) {
+        totalRuns += report.runs.size();
+
+        std::printf("Level %d | upgrades H%d R%d Z%d D%d | %zu runs\n", report.startLevel, report.upgrades.healthUpgrades,
+                    report.upgrades.regenUpgrades, report.upgrades.damageZoneUpgrades, report.upgrades.damageUpgrades,
+                    report.runs.size());
+        PrintHistogram("survival (s)", report.survivalTime);
+        PrintHistogram("points/minute", report.pointsPerMinute);
+        PrintHistogram("nodes destroyed", report.nodesDestroyed);
+    }
+
+    std::printf("%zu runs in %.2f s (%.0f runs/minute)\n", totalRuns, wallTime.count(),
+                wallTime.count() > 0.0 ? totalRuns * 60.0 / wallTime.count() : 0.0);
+    return 0;
+}
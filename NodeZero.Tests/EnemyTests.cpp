@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <memory>
+
 #include "../NodeZero.Core/src/Game.h"
+#include "../NodeZero.Core/src/Simulation/ThreadPool.h"
+#include "../NodeZero.Core/include/Config/MovementProfiles.h"
+#include "../NodeZero.Core/include/Config/NodeArchetypes.h"
 #include "../NodeZero.Core/include/IGame.h"
 #include "../NodeZero.Core/include/INode.h"
 #include "../NodeZero.Core/include/Types/SpawnInfo.h"
@@ -18,7 +24,7 @@ static SpawnInfo CreateTestSpawnInfo(float x, float y) {
 class EnemySpawnTest : public ::testing::Test {
    protected:
     void SetUp() override {
-        game = std::make_unique<Game>();
+        game = std::make_unique<Game>(GameServices::CreateInMemory(42));
         game->Initialize(800.0f, 600.0f);
     }
 
@@ -63,7 +69,7 @@ TEST_F(EnemySpawnTest, EnemyHasValidInitialState) {
 class EnemyDamageTest : public ::testing::Test {
    protected:
     void SetUp() override {
-        game = std::make_unique<Game>();
+        game = std::make_unique<Game>(GameServices::CreateInMemory(42));
         game->Initialize(800.0f, 600.0f);
     }
 
@@ -131,7 +137,7 @@ TEST_F(EnemyDamageTest, MultipleDamageApplications) {
 class EnemyPropertiesTest : public ::testing::Test {
    protected:
     void SetUp() override {
-        game = std::make_unique<Game>();
+        game = std::make_unique<Game>(GameServices::CreateInMemory(42));
         game->Initialize(800.0f, 600.0f);
     }
 
@@ -182,7 +188,7 @@ TEST_F(EnemyPropertiesTest, EnemyHasRotation) {
 class EnemyDestructionTest : public ::testing::Test {
    protected:
     void SetUp() override {
-        game = std::make_unique<Game>();
+        game = std::make_unique<Game>(GameServices::CreateInMemory(42));
         game->Initialize(800.0f, 600.0f);
     }
 
@@ -228,7 +234,7 @@ TEST_F(EnemyDestructionTest, LevelCounterTracksDestroyedEnemies) {
 class EnemyUpdateTest : public ::testing::Test {
    protected:
     void SetUp() override {
-        game = std::make_unique<Game>();
+        game = std::make_unique<Game>(GameServices::CreateInMemory(42));
         game->Initialize(800.0f, 600.0f);
     }
 
@@ -270,4 +276,213 @@ TEST_F(EnemyUpdateTest, EnemyPositionValidAfterUpdate) {
     Position pos = nodes[0]->GetPosition();
     EXPECT_TRUE(std::isfinite(pos.x));
     EXPECT_TRUE(std::isfinite(pos.y));
-}
\ No newline at end of file
+}
+TEST_F(EnemyUpdateTest, PositionIsClosedFormInSimTime) {
+    SpawnInfo info = CreateTestSpawnInfo(400.0f, 300.0f);
+    info.directionX = 0.6f;
+    info.directionY = 0.8f;
+    game->SpawnNode(info);
+    INode* node = game->GetNodes()[0];
+
+    for (int i = 0; i < 300; ++i) {
+        game->Update(1.0f / 60.0f);
+    }
+
+    float distance = node->GetSpeed() * 5.0f;
+    EXPECT_NEAR(node->GetPosition().x, 400.0f + 0.6f * distance, 0.01f);
+    EXPECT_NEAR(node->GetPosition().y, 300.0f + 0.8f * distance, 0.01f);
+    EXPECT_NEAR(node->GetRotation(), 150.0f, 0.01f);
+}
+
+TEST(NodeKinematicsTest, KilledNodeStopsMoving) {
+    Node node(NodeShape::Circle, 10.0f, 100.0f);
+    node.Spawn(0.0f, 0.0f);
+    node.SetDirection(1.0f, 0.0f);
+
+    node.Update(1.0f);
+    node.Kill();
+    node.Update(1.0f);
+
+    EXPECT_FLOAT_EQ(node.GetPosition().x, 100.0f);
+    EXPECT_FLOAT_EQ(node.GetPositionAt(0.5).x, 50.0f);
+}
+
+TEST(NodeArchetypeTest, TableCoversEveryShape) {
+    EXPECT_EQ(NodeArchetypes::COUNT, static_cast<int>(NodeShape::Boss) + 1);
+    EXPECT_EQ(NodeArchetypes::Get(NodeShape::Hexagon).renderRoutine, NodeRenderRoutine::Hexagon);
+    EXPECT_EQ(NodeArchetypes::Get(NodeShape::Boss).renderRoutine, NodeRenderRoutine::Square);
+    EXPECT_FALSE(NodeArchetypes::Get(NodeShape::Boss).separates);
+}
+
+TEST(NodeArchetypeTest, NodeStatsComeFromArchetype) {
+    Node circle(NodeShape::Circle, 20.0f, 75.0f);
+    Node boss(NodeShape::Boss, 100.0f, 35.0f);
+
+    EXPECT_FLOAT_EQ(circle.GetMaxHP(), NodeArchetypes::GetMaxHP(NodeShape::Circle, 20.0f));
+    EXPECT_FLOAT_EQ(boss.GetMaxHP(), 1.0f);
+    EXPECT_EQ(NodeArchetypes::GetPoints(NodeShape::Boss, 3), 1500);
+    EXPECT_FLOAT_EQ(NodeArchetypes::Get(NodeShape::Boss).healthCost, 8.0f * NodeArchetypes::Get(NodeShape::Circle).healthCost);
+}
+
+TEST_F(EnemyUpdateTest, NodesLeavingAnyEdgeAreRetired) {
+    SpawnInfo right = CreateTestSpawnInfo(700.0f, 300.0f);
+    right.directionX = 1.0f;
+    SpawnInfo up = CreateTestSpawnInfo(400.0f, 100.0f);
+    up.directionY = -1.0f;
+    SpawnInfo still = CreateTestSpawnInfo(400.0f, 300.0f);
+
+    game->SpawnNode(right);
+    game->SpawnNode(up);
+    game->SpawnNode(still);
+
+    // 300 px at 75 px/s puts both moving nodes past the 200 px margin
+    for (int i = 0; i < 250; ++i) {
+        game->Update(1.0f / 60.0f);
+    }
+
+    int destroyedBefore = game->GetNodesDestroyed();
+    bool stillPresent = false;
+    for (INode* node : game->GetNodes()) {
+        Position position = node->GetPosition();
+        EXPECT_GE(position.x, -200.0f);
+        EXPECT_LE(position.x, 1000.0f);
+        EXPECT_GE(position.y, -200.0f);
+        EXPECT_LE(position.y, 800.0f);
+        if (position.x == 400.0f && position.y == 300.0f) {
+            stillPresent = true;
+        }
+    }
+
+    EXPECT_TRUE(stillPresent);
+    EXPECT_EQ(destroyedBefore, 0);
+}
+
+TEST(NodeKinematicsTest, SineWaveStaysWithinItsDeviation) {
+    Node node(NodeShape::Circle, 10.0f, 100.0f);
+    node.SetMovement(MovementBehavior::SineWave);
+    node.Spawn(0.0f, 0.0f);
+    node.SetDirection(1.0f, 0.0f);
+
+    const MovementProfile& profile = MovementProfiles::Get(MovementBehavior::SineWave);
+    float largest = 0.0f;
+    for (int i = 0; i <= 200; ++i) {
+        double time = i * 0.01;
+        Position position = node.GetPositionAt(time);
+        EXPECT_NEAR(position.x, 100.0f * time, 0.01f);
+        EXPECT_LE(std::abs(position.y), node.GetPathDeviation() + 0.01f);
+        largest = std::max(largest, std::abs(position.y));
+    }
+    EXPECT_NEAR(largest, profile.waveAmplitude * 10.0f, 0.5f);
+}
+
+TEST(NodeKinematicsTest, SpeedRampsInvertToTravelTimes) {
+    for (MovementBehavior behavior : {MovementBehavior::Accelerate, MovementBehavior::Decelerate}) {
+        Node node(NodeShape::Square, 10.0f, 100.0f);
+        node.SetMovement(behavior);
+        node.Spawn(0.0f, 0.0f);
+        node.SetDirection(0.0f, 1.0f);
+
+        const MovementProfile& profile = MovementProfiles::Get(behavior);
+        double early = node.GetPositionAt(0.1).y / 0.1;
+        double late = (node.GetPositionAt(10.0).y - node.GetPositionAt(9.9).y) / 0.1;
+        EXPECT_NEAR(early, profile.initialSpeed * 100.0f, 5.0);
+        EXPECT_NEAR(late, profile.speedLimit * 100.0f, 0.5);
+
+        for (double time : {0.5, 1.5, 4.0, 12.0}) {
+            EXPECT_NEAR(node.GetTravelTime(node.GetTravelDistance(time)), time, 1e-6);
+        }
+    }
+}
+
+TEST_F(EnemyUpdateTest, HomingNodesTurnTowardTheCursor) {
+    SpawnInfo homing = CreateTestSpawnInfo(400.0f, 300.0f);
+    homing.directionX = 1.0f;
+    homing.movement = MovementBehavior::Homing;
+    SpawnInfo straight = homing;
+    straight.position.y = 500.0f;
+    straight.movement = MovementBehavior::Linear;
+
+    game->SpawnNode(homing);
+    game->SpawnNode(straight);
+    game->SetMousePosition(400.0f, 100.0f);
+
+    for (int i = 0; i < 120; ++i) {
+        game->Update(1.0f / 60.0f);
+    }
+
+    const auto& nodes = game->GetNodes();
+    ASSERT_EQ(nodes.size(), 2);
+    EXPECT_LT(nodes[0]->GetPosition().y, 250.0f);
+    EXPECT_FLOAT_EQ(nodes[1]->GetPosition().y, 500.0f);
+}
+
+TEST_F(EnemyUpdateTest, WavingNodesAreStillRetired) {
+    SpawnInfo info = CreateTestSpawnInfo(700.0f, 300.0f);
+    info.directionX = 1.0f;
+    info.movement = MovementBehavior::Spiral;
+    game->SpawnNode(info);
+
+    // 750 px of travel at 75 px/s takes it well past the margin plus its coil
+    for (int i = 0; i < 600; ++i) {
+        game->Update(1.0f / 60.0f);
+    }
+
+    for (INode* node : game->GetNodes()) {
+        EXPECT_LE(node->GetPosition().x, 1000.0f);
+    }
+    EXPECT_EQ(game->GetNodesDestroyed(), 0);
+}
+
+TEST_F(EnemyUpdateTest, OverlappingNodesArePushedApart) {
+    game->SpawnNode(CreateTestSpawnInfo(400.0f, 300.0f));
+    game->SpawnNode(CreateTestSpawnInfo(400.0f, 300.0f));
+    game->SpawnNode(CreateTestSpawnInfo(405.0f, 302.0f));
+
+    for (int i = 0; i < 120; ++i) {
+        game->Update(1.0f / 60.0f);
+    }
+
+    const auto& nodes = game->GetNodes();
+    ASSERT_GE(nodes.size(), 3);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = i + 1; j < 3; ++j) {
+            float dx = nodes[i]->GetPosition().x - nodes[j]->GetPosition().x;
+            float dy = nodes[i]->GetPosition().y - nodes[j]->GetPosition().y;
+            EXPECT_GT(std::sqrt(dx * dx + dy * dy), nodes[i]->GetSize());
+        }
+    }
+}
+
+TEST(NodeSeparationTest, ParallelChunksMatchSerialResult) {
+    Game serial(GameServices::CreateInMemory(7));
+    Game parallel(GameServices::CreateInMemory(7));
+    ThreadPool pool(4);
+    parallel.SetThreadPool(&pool);
+
+    for (Game* game : {&serial, &parallel}) {
+        game->Initialize(800.0f, 600.0f);
+        for (int i = 0; i < 5000; ++i) {
+            SpawnInfo info = CreateTestSpawnInfo(300.0f + (i % 100) * 2.0f, 200.0f + (i / 100) * 4.0f);
+            info.shape = static_cast<NodeShape>(i % 3);
+            game->SpawnNode(info);
+        }
+    }
+
+    for (int i = 0; i < 5; ++i) {
+        serial.Update(1.0f / 60.0f);
+        parallel.Update(1.0f / 60.0f);
+    }
+
+    const auto& serialNodes = serial.GetNodes();
+    const auto& parallelNodes = parallel.GetNodes();
+    ASSERT_EQ(serialNodes.size(), parallelNodes.size());
+    int moved = 0;
+    for (size_t i = 0; i < serialNodes.size(); ++i) {
+        EXPECT_EQ(serialNodes[i]->GetPosition().x, parallelNodes[i]->GetPosition().x);
+        EXPECT_EQ(serialNodes[i]->GetPosition().y, parallelNodes[i]->GetPosition().y);
+        if (i < 5000 && serialNodes[i]->GetPosition().x != 300.0f + (i % 100) * 2.0f) {
+            moved++;
+        }
+    }
+    EXPECT_GT(moved, 1000);
+}
@@ -1,13 +1,28 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <memory>
 
 #include "../NodeZero.Core/src/Game.h"
+#include "../NodeZero.Core/include/Config/GameConfig.h"
+#include "../NodeZero.Core/include/Config/NodeArchetypes.h"
 #include "../NodeZero.Core/include/IGame.h"
 #include "../NodeZero.Core/include/INode.h"
 #include "../NodeZero.Core/include/Events/IObserver.h"
 #include "../NodeZero.Core/include/Events/IEvent.h"
+#include "../NodeZero.Core/include/Events/GameEvents.h"
+#include "../NodeZero.Core/include/Services/IPickupService.h"
+#include "../NodeZero.Core/include/Services/ILevelService.h"
+#include "../NodeZero.Core/include/Services/IProjectileService.h"
+#include "../NodeZero.Core/include/Services/IRewindService.h"
+#include "../NodeZero.Core/include/Services/ICheckpointService.h"
+#include "../NodeZero.Core/include/Services/IClockService.h"
+#include "../NodeZero.Core/include/Services/IHealthService.h"
+#include "../NodeZero.Core/include/Services/IRunHistoryService.h"
+#include "../NodeZero.Core/include/Services/ISaveService.h"
+#include "../NodeZero.Core/include/Services/IUpgradeService.h"
 #include "../NodeZero.Core/include/Types/SpawnInfo.h"
+#include "../NodeZero.Core/include/Services/GameServices.h"
 
 // Helper function to create SpawnInfo for tests
 static SpawnInfo CreateTestSpawnInfo(float x, float y) {
@@ -29,10 +44,18 @@ public:
     int GetEventCount() const { return m_EventCount; }
 };
 
+class RecordingObserver : public IObserver {
+public:
+    std::vector<std::shared_ptr<GameEvent>> events;
+    void Update(const std::shared_ptr<IEvent>& event) override {
+        events.push_back(std::static_pointer_cast<GameEvent>(event));
+    }
+};
+
 class GameTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        game = std::make_unique<Game>();
+        game = std::make_unique<Game>(GameServices::CreateInMemory(42));
         game->Initialize(800.0f, 600.0f);
         game->Reset();
     }
@@ -55,6 +78,87 @@ TEST_F(GameTest, SpawnNodeWorks) {
     EXPECT_FLOAT_EQ(nodes[0]->GetPosition().y, 300.0f);
 }
 
+TEST_F(GameTest, CaptureSnapshotCopiesActiveNodesAndHud) {
+    game->SpawnNode(CreateTestSpawnInfo(100.0f, 150.0f));
+    game->SpawnNode(CreateTestSpawnInfo(200.0f, 250.0f));
+    game->SpawnNode(CreateTestSpawnInfo(300.0f, 350.0f));
+    game->GetNodes()[1]->Kill();
+    game->SetMousePosition(40.0f, 60.0f);
+
+    WorldSnapshot snapshot;
+    game->CaptureSnapshot(snapshot);
+
+    EXPECT_EQ(game->GetNodeCount(), 3u);
+    ASSERT_EQ(snapshot.nodes.size(), 2u);
+    EXPECT_FLOAT_EQ(snapshot.nodes[0].x, 100.0f);
+    EXPECT_FLOAT_EQ(snapshot.nodes[1].y, 350.0f);
+    EXPECT_NE(snapshot.nodes[0].id, snapshot.nodes[1].id);
+    EXPECT_FLOAT_EQ(snapshot.nodes[0].hp, game->GetNodes()[0]->GetHP());
+    EXPECT_FLOAT_EQ(snapshot.zoneCenter.x, 40.0f);
+    EXPECT_FLOAT_EQ(snapshot.health, game->GetHealthService().GetCurrent());
+    EXPECT_FLOAT_EQ(snapshot.damageZoneSize, game->GetUpgradeService().GetDamageZoneSize());
+    EXPECT_EQ(snapshot.level, game->GetLevelService().GetCurrentLevel());
+
+    // Reusing the buffer replaces its contents
+    game->Reset();
+    game->CaptureSnapshot(snapshot);
+    EXPECT_TRUE(snapshot.nodes.empty());
+}
+
+TEST_F(GameTest, RewindRecordsEachUpdateUntilReset) {
+    game->GetRewindService().SetEnabled(true);
+    game->SpawnNode(CreateTestSpawnInfo(100.0f, 150.0f));
+    for (int tick = 0; tick < 5; ++tick) {
+        game->Update(0.05f);
+    }
+
+    IRewindService& rewind = game->GetRewindService();
+    ASSERT_EQ(rewind.GetFrameCount(), 5u);
+    WorldSnapshot live;
+    WorldSnapshot recorded;
+    game->CaptureSnapshot(live);
+    ASSERT_TRUE(rewind.ReadFrame(recorded));
+    ASSERT_EQ(recorded.nodes.size(), live.nodes.size());
+    EXPECT_EQ(recorded.nodes[0].x, live.nodes[0].x);
+
+    game->Reset();
+    EXPECT_EQ(rewind.GetFrameCount(), 0u);
+    EXPECT_TRUE(rewind.IsEnabled());
+}
+
+TEST_F(GameTest, CheckpointIsDiscardedWhenHealthRunsOut) {
+    ICheckpointService& checkpoints = game->GetCheckpointService();
+    game->Update(0.05f);
+    EXPECT_TRUE(checkpoints.HasCheckpoint());
+
+    game->GetHealthService().Reduce(1.0e6f);
+    game->Update(0.05f);
+    EXPECT_FALSE(checkpoints.HasCheckpoint());
+    EXPECT_FALSE(game->ResumeFromCheckpoint());
+}
+
+TEST_F(GameTest, EndRunRecordsTheRunOnce) {
+    IRunHistoryService& history = game->GetRunHistoryService();
+    game->Update(0.5f);
+    game->Update(0.25f);
+    EXPECT_TRUE(game->GetCheckpointService().HasCheckpoint());
+
+    game->EndRun();
+    game->EndRun();
+    ASSERT_EQ(history.GetRunCount(), 1u);
+    RunRecord run = history.GetRun(0);
+    EXPECT_EQ(run.levelReached, static_cast<uint32_t>(game->GetLevelService().GetCurrentLevel()));
+    EXPECT_EQ(run.durationMilliseconds, 750u);
+    EXPECT_EQ(run.upgrades, 0u);
+    EXPECT_EQ(game->GetSaveService().GetCurrentData().gamesPlayed, 1);
+    EXPECT_FALSE(game->GetCheckpointService().HasCheckpoint());
+
+    game->Reset();
+    game->EndRun();
+    EXPECT_EQ(history.GetRunCount(), 2u);
+    EXPECT_EQ(game->GetSaveService().GetCurrentData().gamesPlayed, 2);
+}
+
 TEST_F(GameTest, MultipleNodesCanSpawn) {
     game->SpawnNode(CreateTestSpawnInfo(100.0f, 100.0f));
     game->SpawnNode(CreateTestSpawnInfo(200.0f, 200.0f));
@@ -213,3 +317,335 @@ TEST_F(GameTest, MultipleResetsCycleCorrectly) {
         EXPECT_EQ(game->GetNodes().size(), 0);
     }
 }
+
+TEST(GameServicesTest, SaveProgressGoesToInjectedService) {
+    SaveData initialData;
+    initialData.points = 10;
+    Game game(GameServices::CreateInMemory(1, initialData));
+    game.Initialize(800.0f, 600.0f);
+
+    game.SpawnNode(CreateTestSpawnInfo(400.0f, 300.0f));
+    game.GetNodes()[0]->TakeDamage(10000.0f);
+    game.Update(0.016f);
+    game.SaveProgress();
+
+    SaveData saved = game.GetSaveService().GetCurrentData();
+    EXPECT_EQ(saved.points, 10);
+    EXPECT_EQ(saved.totalNodesDestroyed, 1);
+}
+
+// Moves on 2 ms every time it is read
+class SteppingClock : public IClockService {
+   private:
+    mutable double m_Time = 0.0;
+
+   public:
+    double GetTime() const override {
+        m_Time += 0.002;
+        return m_Time;
+    }
+};
+
+TEST(GameServicesTest, UpdateIsTimedOnTheInjectedClock) {
+    Game manual(GameServices::CreateInMemory(4));
+    manual.Initialize(800.0f, 600.0f);
+    manual.Update(0.016f);
+    EXPECT_EQ(manual.GetUpdateMilliseconds(), 0.0);
+
+    GameServices services = GameServices::CreateInMemory(4);
+    services.clockService = std::make_unique<SteppingClock>();
+    Game stepped(std::move(services));
+    stepped.Initialize(800.0f, 600.0f);
+    stepped.Update(0.016f);
+    EXPECT_NEAR(stepped.GetUpdateMilliseconds(), 2.0, 1e-9);
+}
+
+TEST(GameServicesTest, SameSeedGivesSameSimulation) {
+    Game first(GameServices::CreateInMemory(99));
+    Game second(GameServices::CreateInMemory(99));
+    first.Initialize(800.0f, 600.0f);
+    second.Initialize(800.0f, 600.0f);
+
+    for (int i = 0; i < 200; ++i) {
+        first.Update(0.05f);
+        second.Update(0.05f);
+    }
+
+    const auto& firstNodes = first.GetNodes();
+    const auto& secondNodes = second.GetNodes();
+    ASSERT_EQ(firstNodes.size(), secondNodes.size());
+    ASSERT_GT(firstNodes.size(), 0);
+    for (size_t i = 0; i < firstNodes.size(); ++i) {
+        EXPECT_FLOAT_EQ(firstNodes[i]->GetPosition().x, secondNodes[i]->GetPosition().x);
+        EXPECT_FLOAT_EQ(firstNodes[i]->GetPosition().y, secondNodes[i]->GetPosition().y);
+        EXPECT_EQ(firstNodes[i]->GetShape(), secondNodes[i]->GetShape());
+    }
+}
+
+TEST_F(GameTest, ChainKillsAreReportedInOneBatch) {
+    for (int i = 0; i < 50; ++i) {
+        game->SpawnNode(CreateTestSpawnInfo(100.0f + i * 10.0f, 300.0f));
+    }
+    for (INode* node : game->GetNodes()) {
+        node->Kill();
+    }
+
+    auto observer = std::make_shared<RecordingObserver>();
+    game->Attach(observer);
+    game->Update(0.001f);
+
+    int batches = 0;
+    for (const auto& event : observer->events) {
+        if (event->type == EventType::NodesDestroyed) {
+            batches++;
+            EXPECT_EQ(event->count, 50);
+            EXPECT_EQ(event->positions.size(), 50);
+            EXPECT_EQ(event->points, 50 * 100);
+        }
+    }
+
+    EXPECT_EQ(batches, 1);
+    EXPECT_EQ(game->GetNodes().size(), 0);
+    EXPECT_EQ(game->GetNodesDestroyed(), 50);
+    EXPECT_EQ(game->GetLevelService().GetNodesDestroyedThisLevel(), 50);
+    EXPECT_GE(game->GetPickupService().GetPickups().size(), 50 * 5);
+}
+
+TEST_F(GameTest, ExplosiveDeathsChainWithinOneTick) {
+    ASSERT_GT(NodeArchetypes::Get(NodeShape::Hexagon).explosionRadius, 0.0f);
+
+    // Each blast reaches the next hexagon in the line and no further
+    for (int i = 0; i < 8; ++i) {
+        SpawnInfo info = CreateTestSpawnInfo(100.0f + i * 80.0f, 300.0f);
+        info.shape = NodeShape::Hexagon;
+        game->SpawnNode(info);
+    }
+    game->GetNodes()[0]->Kill();
+
+    auto observer = std::make_shared<RecordingObserver>();
+    game->Attach(observer);
+    game->Update(0.001f);
+
+    int batches = 0;
+    for (const auto& event : observer->events) {
+        if (event->type == EventType::NodesDestroyed) {
+            batches++;
+            EXPECT_EQ(event->count, 8);
+        }
+    }
+    EXPECT_EQ(batches, 1);
+    EXPECT_EQ(game->GetNodesDestroyed(), 8);
+}
+
+TEST_F(GameTest, ChainExplosionsPastTheCapCarryOver) {
+    const int chainLength = GameConfig::CHAIN_EXPLOSIONS_PER_TICK + 44;
+    for (int i = 0; i < chainLength; ++i) {
+        SpawnInfo info = CreateTestSpawnInfo(100.0f + i * 80.0f, 300.0f);
+        info.shape = NodeShape::Hexagon;
+        game->SpawnNode(info);
+    }
+    game->GetNodes()[0]->Kill();
+
+    game->Update(0.001f);
+    EXPECT_EQ(game->GetNodesDestroyed(), GameConfig::CHAIN_EXPLOSIONS_PER_TICK + 1);
+
+    game->Update(0.001f);
+    EXPECT_EQ(game->GetNodesDestroyed(), chainLength);
+}
+
+TEST_F(GameTest, ProjectileHitsCostHealth) {
+    auto observer = std::make_shared<RecordingObserver>();
+    game->Attach(observer);
+    game->SetMousePosition(400.0f, 300.0f);
+
+    float healthBefore = game->GetHealthService().GetCurrent();
+    game->GetProjectileService().FireRadial(Position{400.0f, 300.0f}, 3, 10.0f, 0.0f);
+    game->Update(0.016f);
+
+    EXPECT_EQ(game->GetProjectileService().GetActiveCount(), 0u);
+    EXPECT_LT(game->GetHealthService().GetCurrent(),
+              healthBefore - 2.5f * GameConfig::PROJECTILE_HEALTH_COST);
+
+    int hits = 0;
+    for (const auto& event : observer->events) {
+        if (event->type == EventType::ProjectilesHit) {
+            hits += event->count;
+        }
+    }
+    EXPECT_EQ(hits, 3);
+}
+
+TEST(GameServicesTest, RingWaveScriptRunsFromItsFirstLevel) {
+    SaveData initialData;
+    initialData.currentLevel = GameConfig::RING_WAVE_FIRST_LEVEL;
+    Game game(GameServices::CreateInMemory(5, initialData));
+    game.Initialize(800.0f, 600.0f);
+    game.Reset();
+
+    auto observer = std::make_shared<RecordingObserver>();
+    game.Attach(observer);
+
+    float ringRadius = GameConfig::RING_WAVE_RADIUS * 600.0f;
+    auto countRingSpawns = [&]() {
+        int count = 0;
+        for (const auto& event : observer->events) {
+            if (event->type != EventType::NodesSpawned) {
+                continue;
+            }
+            for (const Position& position : event->positions) {
+                float dx = position.x - 400.0f;
+                float dy = position.y - 300.0f;
+                if (std::abs(std::sqrt(dx * dx + dy * dy) - ringRadius) < 1.0f) {
+                    count++;
+                }
+            }
+        }
+        return count;
+    };
+
+    float elapsed = 0.0f;
+    while (elapsed < GameConfig::RING_WAVE_INTERVAL - 0.1f) {
+        game.Update(0.05f);
+        elapsed += 0.05f;
+    }
+    EXPECT_EQ(countRingSpawns(), 0);
+
+    for (int i = 0; i < 4; ++i) {
+        game.Update(0.05f);
+    }
+    EXPECT_EQ(countRingSpawns(), GameConfig::RING_WAVE_COUNT);
+}
+
+TEST_F(GameTest, SpawnNodesReportsOneBatchEvent) {
+    auto observer = std::make_shared<RecordingObserver>();
+    game->Attach(observer);
+
+    std::vector<SpawnInfo> infos;
+    for (int i = 0; i < 300; ++i) {
+        infos.push_back(CreateTestSpawnInfo(10.0f + i * 2.0f, 300.0f));
+    }
+    game->SpawnNodes(infos);
+
+    EXPECT_EQ(game->GetNodes().size(), 300u);
+    ASSERT_EQ(observer->events.size(), 1u);
+    EXPECT_EQ(observer->events[0]->type, EventType::NodesSpawned);
+    EXPECT_EQ(observer->events[0]->count, 300);
+    ASSERT_EQ(observer->events[0]->positions.size(), 300u);
+    EXPECT_FLOAT_EQ(observer->events[0]->positions[299].x, 608.0f);
+}
+
+TEST(GameServicesTest, NextLevelRestartsLevelScripts) {
+    SaveData initialData;
+    initialData.currentLevel = GameConfig::RING_WAVE_FIRST_LEVEL - 1;
+    Game game(GameServices::CreateInMemory(5, initialData));
+    game.Initialize(800.0f, 600.0f);
+    game.Reset();
+    game.StartNextLevel();
+
+    auto observer = std::make_shared<RecordingObserver>();
+    game.Attach(observer);
+
+    float elapsed = 0.0f;
+    while (elapsed < GameConfig::RING_WAVE_INTERVAL + 0.1f) {
+        game.Update(0.05f);
+        elapsed += 0.05f;
+    }
+
+    float ringRadius = GameConfig::RING_WAVE_RADIUS * 600.0f;
+    int ringSpawns = 0;
+    for (const auto& event : observer->events) {
+        if (event->type != EventType::NodesSpawned) {
+            continue;
+        }
+        for (const Position& position : event->positions) {
+            float dx = position.x - 400.0f;
+            float dy = position.y - 300.0f;
+            if (std::abs(std::sqrt(dx * dx + dy * dy) - ringRadius) < 1.0f) {
+                ringSpawns++;
+            }
+        }
+    }
+    EXPECT_EQ(ringSpawns, GameConfig::RING_WAVE_COUNT);
+}
+
+TEST(GameServicesTest, OverloadOutpacesStandardSpawningWithoutALevelClock) {
+    auto countSpawned = [](GameMode mode, float& progress) {
+        Game game(GameServices::CreateInMemory(9));
+        game.Initialize(800.0f, 600.0f);
+        game.SetGameMode(mode);
+        game.Reset();
+
+        auto observer = std::make_shared<RecordingObserver>();
+        game.Attach(observer);
+        for (int tick = 0; tick < 400; ++tick) {
+            game.Update(0.05f);
+        }
+        progress = game.GetLevelService().GetProgressBarPercentage();
+
+        size_t spawned = 0;
+        for (const auto& event : observer->events) {
+            if (event->type == EventType::NodeSpawned) {
+                spawned++;
+            } else if (event->type == EventType::NodesSpawned) {
+                spawned += event->positions.size();
+            }
+        }
+        return spawned;
+    };
+
+    float standardProgress = 0.0f;
+    float overloadProgress = 0.0f;
+    size_t standard = countSpawned(GameMode::Standard, standardProgress);
+    size_t overload = countSpawned(GameMode::Overload, overloadProgress);
+
+    EXPECT_GT(overload, standard * 2);
+    EXPECT_GT(standardProgress, 0.0f);
+    EXPECT_FLOAT_EQ(overloadProgress, 0.0f);
+}
+
+TEST(GameServicesTest, ResumedRunContinuesLikeTheOriginal) {
+    Game original(GameServices::CreateInMemory(31));
+    original.Initialize(800.0f, 600.0f);
+    original.Reset();
+    auto moveCursor = [](Game& game, int tick) {
+        game.SetMousePosition(400.0f + 200.0f * std::sin(tick * 0.05f), 300.0f + 150.0f * std::cos(tick * 0.03f));
+    };
+    for (int tick = 0; tick < 240; ++tick) {
+        moveCursor(original, tick);
+        original.Update(1.0f / 60.0f);
+    }
+
+    Checkpoint checkpoint;
+    original.CaptureCheckpoint(checkpoint);
+    ASSERT_GT(checkpoint.nodes.size(), 0u);
+
+    // A different seed, so everything that matches came from the checkpoint
+    Game resumed(GameServices::CreateInMemory(77));
+    resumed.Initialize(800.0f, 600.0f);
+    resumed.GetCheckpointService().Submit(checkpoint);
+    ASSERT_TRUE(resumed.ResumeFromCheckpoint());
+
+    for (int tick = 240; tick < 480; ++tick) {
+        moveCursor(original, tick);
+        moveCursor(resumed, tick);
+        original.Update(1.0f / 60.0f);
+        resumed.Update(1.0f / 60.0f);
+    }
+
+    WorldSnapshot expected;
+    WorldSnapshot actual;
+    original.CaptureSnapshot(expected);
+    resumed.CaptureSnapshot(actual);
+    EXPECT_EQ(actual.simTime, expected.simTime);
+    EXPECT_EQ(actual.health, expected.health);
+    EXPECT_EQ(actual.pickupPoints, expected.pickupPoints);
+    EXPECT_EQ(actual.pickups.size(), expected.pickups.size());
+    EXPECT_EQ(resumed.GetNodesDestroyed(), original.GetNodesDestroyed());
+    ASSERT_EQ(actual.nodes.size(), expected.nodes.size());
+    for (size_t i = 0; i < expected.nodes.size(); ++i) {
+        EXPECT_EQ(actual.nodes[i].id, expected.nodes[i].id);
+        EXPECT_FLOAT_EQ(actual.nodes[i].x, expected.nodes[i].x);
+        EXPECT_FLOAT_EQ(actual.nodes[i].y, expected.nodes[i].y);
+        EXPECT_FLOAT_EQ(actual.nodes[i].hp, expected.nodes[i].hp);
+    }
+}
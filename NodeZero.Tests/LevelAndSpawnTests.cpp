@@ -1,11 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <fstream>
+#include <vector>
 
 #include "../NodeZero.Core/src/Services/LevelService.h"
 #include "../NodeZero.Core/src/Services/SpawnService.h"
+#include "../NodeZero.Core/src/Scripting/Script.h"
+#include "../NodeZero.Core/src/Scripting/ScriptScheduler.h"
 #include "../NodeZero.Core/include/Config/GameConfig.h"
+#include "../NodeZero.Core/include/Config/LevelTable.h"
+#include "../NodeZero.Core/include/Config/MovementProfiles.h"
+#include "../NodeZero.Core/include/Config/NodeArchetypes.h"
 #include "../NodeZero.Core/include/Enums/NodeShape.h"
 #include "../NodeZero.Core/include/Types/SpawnInfo.h"
 
@@ -158,3 +167,288 @@ TEST_F(SpawnServiceTest, GetNextSpawnReturnsValidData) {
     float length = std::sqrt(info.directionX * info.directionX + info.directionY * info.directionY);
     EXPECT_NEAR(length, 1.0f, 0.001f);
 }
+
+TEST(LevelTableTest, DefaultTableMatchesConfigCurves) {
+    const LevelTable& table = LevelTable::Default();
+
+    EXPECT_EQ(table.GetLevelCount(), GameConfig::LEVEL_TABLE_SIZE);
+    EXPECT_FLOAT_EQ(table.Get(1).spawnInterval, 2.0f);
+    EXPECT_FLOAT_EQ(table.Get(3).nodeHPScale, 1.4f);
+    EXPECT_FLOAT_EQ(table.Get(20).spawnInterval, GameConfig::SPAWN_INTERVAL_MIN);
+    EXPECT_FLOAT_EQ(table.Get(4).bossHP, GameConfig::BOSS_HP_BASE + 300.0f);
+    EXPECT_FLOAT_EQ(table.Get(0).nodeHPScale, table.Get(1).nodeHPScale);
+    EXPECT_FLOAT_EQ(table.Get(1000).bossHP, table.Get(GameConfig::LEVEL_TABLE_SIZE).bossHP);
+}
+
+TEST(LevelTableTest, LoadFromFileOverridesListedLevels) {
+    const char* path = "level_table_test.txt";
+    {
+        std::ofstream file(path);
+        file << "# level spawn hp depletion cost boss\n";
+        file << "2 1.0 3.0 1.5 2.5 999\n";
+    }
+
+    LevelTable table;
+    ASSERT_TRUE(table.LoadFromFile(path));
+    std::remove(path);
+
+    EXPECT_FLOAT_EQ(table.Get(2).spawnInterval, 1.0f);
+    EXPECT_FLOAT_EQ(table.Get(2).nodeHPScale, 3.0f);
+    EXPECT_FLOAT_EQ(table.Get(2).bossHP, 999.0f);
+    EXPECT_FLOAT_EQ(table.Get(3).nodeHPScale, LevelTable::ComputeDefault(3).nodeHPScale);
+    EXPECT_FALSE(table.LoadFromFile("missing_level_table.txt"));
+}
+
+TEST_F(SpawnServiceTest, ReadsCoefficientsFromLevelTable) {
+    LevelTable table;
+    table.Set(2, LevelParams{0.25f, 10.0f, 1.0f, 1.0f, 1.0f});
+
+    spawnService->SetLevelTable(&table);
+    spawnService->SetCurrentLevel(2);
+
+    EXPECT_FLOAT_EQ(spawnService->CalculateNodeHP(10.0f), 100.0f);
+    spawnService->UpdateAutoSpawn(0.3f);
+    EXPECT_TRUE(spawnService->ShouldAutoSpawn());
+}
+
+TEST_F(SpawnServiceTest, MovementBehaviorsUnlockByLevel) {
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(spawnService->GetNextSpawn().movement, MovementBehavior::Linear);
+    }
+
+    spawnService->SetCurrentLevel(10);
+    bool seen[MovementProfiles::COUNT] = {};
+    for (int i = 0; i < 2000; ++i) {
+        SpawnInfo info = spawnService->GetNextSpawn();
+        EXPECT_TRUE(NodeArchetypes::Get(info.shape).movements & MovementProfiles::Bit(info.movement));
+        seen[static_cast<int>(info.movement)] = true;
+    }
+    for (int i = 0; i < MovementProfiles::COUNT; ++i) {
+        EXPECT_TRUE(seen[i]) << "behavior " << i;
+    }
+}
+
+TEST_F(SpawnServiceTest, ScheduleIsReproducibleFromItsSeed) {
+    SpawnService other;
+    other.Initialize(800.0f, 600.0f);
+    spawnService->BuildSchedule(1234u, 0.0f, 60.0f);
+    other.BuildSchedule(1234u, 0.0f, 60.0f);
+    ASSERT_EQ(spawnService->GetScheduledCount(), other.GetScheduledCount());
+
+    spawnService->UpdateAutoSpawn(60.0f);
+    other.UpdateAutoSpawn(60.0f);
+    std::vector<SpawnInfo> first;
+    std::vector<SpawnInfo> second;
+    spawnService->TakeDueSpawns(first);
+    other.TakeDueSpawns(second);
+
+    ASSERT_EQ(first.size(), second.size());
+    for (size_t i = 0; i < first.size(); ++i) {
+        EXPECT_FLOAT_EQ(first[i].position.x, second[i].position.x);
+        EXPECT_FLOAT_EQ(first[i].position.y, second[i].position.y);
+        EXPECT_EQ(first[i].shape, second[i].shape);
+    }
+}
+
+TEST_F(SpawnServiceTest, FormationsJoinTheScheduleFromTheirFirstLevel) {
+    spawnService->BuildSchedule(99u, 0.0f, 60.0f);
+    size_t levelOne = spawnService->GetScheduledCount();
+    float interval = LevelTable::Default().Get(1).spawnInterval;
+    size_t singles = static_cast<size_t>(60.0f / interval);
+    size_t maxBursts = static_cast<size_t>(60.0f / (GameConfig::SPAWN_BURST_INTERVAL * 0.75f)) + 1;
+    EXPECT_GE(levelOne, singles);
+    EXPECT_LE(levelOne, singles + maxBursts * GameConfig::SPAWN_BURST_MAX);
+
+    spawnService->SetCurrentLevel(GameConfig::SPAWN_FORMATION_FIRST_LEVEL);
+    spawnService->BuildSchedule(99u, 0.0f, 60.0f);
+    int formationSize = GameConfig::SPAWN_FORMATION_BASE +
+                        GameConfig::SPAWN_FORMATION_PER_LEVEL * GameConfig::SPAWN_FORMATION_FIRST_LEVEL;
+    EXPECT_GE(spawnService->GetScheduledCount(), singles + 2 * formationSize);
+}
+
+TEST_F(SpawnServiceTest, DueSpawnsFollowTheClockAcrossSegments) {
+    std::vector<SpawnInfo> due;
+    spawnService->TakeDueSpawns(due);
+    EXPECT_TRUE(due.empty());
+
+    float interval = LevelTable::Default().Get(1).spawnInterval;
+    spawnService->UpdateAutoSpawn(interval * 0.5f);
+    spawnService->TakeDueSpawns(due);
+    EXPECT_TRUE(due.empty());
+
+    // Two and a half segments in small ticks, never losing the cadence at a segment edge
+    size_t taken = 0;
+    for (int tick = 0; tick < 2500; ++tick) {
+        spawnService->UpdateAutoSpawn(0.06f);
+        due.clear();
+        spawnService->TakeDueSpawns(due);
+        taken += due.size();
+    }
+    EXPECT_GE(taken, static_cast<size_t>(150.0f / interval) - 1);
+
+    spawnService->ResetSpawnTimer();
+    due.clear();
+    spawnService->TakeDueSpawns(due);
+    EXPECT_TRUE(due.empty());
+}
+
+TEST_F(SpawnServiceTest, OverloadSegmentsNeverOutgrowTheRoomLeft) {
+    spawnService->SetOverload(true);
+    spawnService->SetOverloadRoom(50);
+    spawnService->BuildSchedule(7u, 120.0f, GameConfig::OVERLOAD_SCHEDULE_SEGMENT);
+    EXPECT_EQ(spawnService->GetScheduledCount(), 50u);
+
+    // Far past the point where the doubling rate would overflow, a segment still fills the field at most once
+    spawnService->SetOverloadRoom(GameConfig::OVERLOAD_MAX_NODES);
+    spawnService->BuildSchedule(7u, 400.0f, GameConfig::OVERLOAD_SCHEDULE_SEGMENT);
+    EXPECT_GT(spawnService->GetScheduledCount(), 0u);
+    EXPECT_LE(spawnService->GetScheduledCount(), static_cast<size_t>(GameConfig::OVERLOAD_MAX_NODES));
+
+    spawnService->SetOverloadRoom(0);
+    spawnService->BuildSchedule(7u, 400.0f, GameConfig::OVERLOAD_SCHEDULE_SEGMENT);
+    EXPECT_EQ(spawnService->GetScheduledCount(), 0u);
+}
+
+class RecordingScriptHost : public IScriptHost {
+public:
+    int resumes = 0;
+    bool ownerAlive = true;
+    float ownerHealth = 1.0f;
+    std::vector<float> radialAngles;
+    std::vector<int> ringCounts;
+
+    bool GetOwnerPosition(int ownerId, Position& position) const override {
+        const_cast<RecordingScriptHost*>(this)->resumes++;
+        position = Position{100.0f, 100.0f};
+        return ownerId == NO_OWNER || ownerAlive;
+    }
+    float GetOwnerHealthRatio(int) const override { return ownerHealth; }
+    Position GetAimTarget() const override { return Position{0.0f, 0.0f}; }
+    float NextRandomUnit() override { return 0.5f; }
+    void FireRadial(const Position&, int, float startAngle) override { radialAngles.push_back(startAngle); }
+    void FireAimed(const Position&, const Position&, int, float) override {}
+    void SpawnRing(const Position&, int count, float, NodeShape, bool) override { ringCounts.push_back(count); }
+    float MoveOwnerTo(int, float, float) override { return 2.0f; }
+    void StopOwner(int) override {}
+    float GetScreenWidth() const override { return 800.0f; }
+    float GetScreenHeight() const override { return 600.0f; }
+};
+
+TEST(ScriptSchedulerTest, RepeatRunsTheLoopBodyAndThenEnds) {
+    Script script;
+    script.Aim(0.0f);
+    size_t loop = script.Here();
+    script.FireRadial(4).Turn(10.0f).Wait(0.1f).Repeat(loop, 3);
+
+    ScriptScheduler scheduler;
+    RecordingScriptHost host;
+    scheduler.Start(script, IScriptHost::NO_OWNER, 0.0);
+
+    for (int tick = 0; tick <= 60; ++tick) {
+        scheduler.Update(tick / 60.0, host);
+    }
+
+    ASSERT_EQ(host.radialAngles.size(), 3u);
+    EXPECT_FLOAT_EQ(host.radialAngles[0], 0.0f);
+    EXPECT_FLOAT_EQ(host.radialAngles[1], 10.0f);
+    EXPECT_FLOAT_EQ(host.radialAngles[2], 20.0f);
+    EXPECT_EQ(scheduler.GetRunningCount(), 0u);
+}
+
+TEST(ScriptSchedulerTest, WaitsKeepCadenceAcrossLongTicks) {
+    Script script;
+    size_t loop = script.Here();
+    script.FireRadial(1).Wait(0.25f).Jump(loop);
+
+    ScriptScheduler scheduler;
+    RecordingScriptHost host;
+    scheduler.Start(script, IScriptHost::NO_OWNER, 0.0);
+
+    // One 1-second tick still fires every volley that fell inside it
+    scheduler.Update(1.0, host);
+    EXPECT_EQ(host.radialAngles.size(), 5u);
+}
+
+TEST(ScriptSchedulerTest, OnlyDueScriptsAreResumed) {
+    Script sleeper;
+    sleeper.Wait(10.0f).FireRadial(1);
+    Script ticker;
+    size_t loop = ticker.Here();
+    ticker.FireRadial(1).Wait(1.0f).Jump(loop);
+
+    ScriptScheduler scheduler;
+    RecordingScriptHost host;
+    for (int i = 0; i < 1000; ++i) {
+        scheduler.Start(sleeper, IScriptHost::NO_OWNER, 0.0);
+    }
+    scheduler.Update(0.0, host);
+    scheduler.Start(ticker, IScriptHost::NO_OWNER, 0.5);
+
+    host.resumes = 0;
+    scheduler.Update(0.5, host);
+    scheduler.Update(1.0, host);
+    scheduler.Update(1.5, host);
+    EXPECT_EQ(host.resumes, 2);
+    EXPECT_EQ(scheduler.GetRunningCount(), 1001u);
+}
+
+TEST(ScriptSchedulerTest, ScriptEndsWithItsOwnerOrWhenStopped) {
+    Script script;
+    size_t loop = script.Here();
+    script.FireRadial(1).Wait(1.0f).Jump(loop);
+
+    ScriptScheduler scheduler;
+    RecordingScriptHost host;
+    ScriptHandle owned = scheduler.Start(script, 7, 0.0);
+    ScriptHandle free = scheduler.Start(script, IScriptHost::NO_OWNER, 0.0);
+    scheduler.Update(0.0, host);
+
+    host.ownerAlive = false;
+    scheduler.Update(1.0, host);
+    EXPECT_FALSE(scheduler.IsRunning(owned));
+    EXPECT_TRUE(scheduler.IsRunning(free));
+
+    scheduler.Stop(free);
+    EXPECT_FALSE(scheduler.IsRunning(free));
+
+    // The freed slot is reused; the old handle stays stale
+    ScriptHandle reused = scheduler.Start(script, IScriptHost::NO_OWNER, 2.0);
+    EXPECT_TRUE(scheduler.IsRunning(reused));
+    EXPECT_FALSE(scheduler.IsRunning(free));
+    EXPECT_EQ(scheduler.GetRunningCount(), 1u);
+}
+
+TEST(ScriptSchedulerTest, HealthBranchSwitchesPhase) {
+    Script script;
+    size_t calm = script.Here();
+    script.FireRadial(1).Wait(1.0f);
+    size_t check = script.Here();
+    script.JumpIfHealthBelow(0.5f, check + 2).Jump(calm);
+    script.SpawnRing(6, 0.1f, NodeShape::Square, false);
+
+    ScriptScheduler scheduler;
+    RecordingScriptHost host;
+    scheduler.Start(script, 3, 0.0);
+    scheduler.Update(0.0, host);
+    scheduler.Update(1.0, host);
+    EXPECT_EQ(host.radialAngles.size(), 2u);
+    EXPECT_TRUE(host.ringCounts.empty());
+
+    host.ownerHealth = 0.25f;
+    scheduler.Update(2.0, host);
+    ASSERT_EQ(host.ringCounts.size(), 1u);
+    EXPECT_EQ(host.ringCounts[0], 6);
+    EXPECT_EQ(scheduler.GetRunningCount(), 0u);
+}
+
+TEST(ScriptSchedulerTest, LoopWithoutWaitYieldsEachTick) {
+    Script script;
+    size_t loop = script.Here();
+    script.FireRadial(1).Jump(loop);
+
+    ScriptScheduler scheduler;
+    RecordingScriptHost host;
+    scheduler.Start(script, IScriptHost::NO_OWNER, 0.0);
+    scheduler.Update(0.0, host);
+    EXPECT_EQ(host.radialAngles.size(), static_cast<size_t>(ScriptScheduler::MAX_STEPS_PER_RESUME / 2));
+}
@@ -1,14 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdlib>
 #include <ctime>
 
 #include "../NodeZero.Core/src/Services/PickupService.h"
 #include "../NodeZero.Core/src/Services/DamageZoneService.h"
+#include "../NodeZero.Core/src/Services/ProjectileService.h"
 #include "../NodeZero.Core/src/Node.h"
+#include "../NodeZero.Core/src/Math/FastMath.h"
+#include "../NodeZero.Core/src/Math/ZoneGeometry.h"
 #include "../NodeZero.Core/include/Config/GameConfig.h"
 #include "../NodeZero.Core/include/Enums/NodeShape.h"
 #include "../NodeZero.Core/include/Enums/NodeState.h"
+#include "../NodeZero.Core/include/Types/DamageZone.h"
 #include "../NodeZero.Core/include/Types/PointPickup.h"
 #include "../NodeZero.Core/include/Types/Position.h"
 
@@ -121,6 +127,134 @@ TEST_F(PickupServiceTest, ProcessCollectionWorks) {
     EXPECT_GT(collected.size(), 0);
 }
 
+TEST_F(PickupServiceTest, SweptCollectionCatchesPickupsBetweenFrames) {
+    pickupService->SpawnPointPickups(Position{200.0f, 300.0f}, 8, 1);
+    pickupService->Update(GameConfig::PICKUP_COLLECT_DELAY + 0.01f);
+
+    // Neither endpoint's zone reaches the burst, only the path between them does
+    std::vector<PointPickup> collected;
+    pickupService->ProcessPickupCollection(0.0f, 300.0f, 80.0f, collected);
+    EXPECT_EQ(collected.size(), 0);
+    pickupService->ProcessPickupCollection(400.0f, 300.0f, 80.0f, collected);
+    EXPECT_EQ(collected.size(), 0);
+
+    pickupService->ProcessPickupCollection(0.0f, 300.0f, 400.0f, 300.0f, 80.0f, collected);
+    EXPECT_EQ(collected.size(), 8);
+    EXPECT_EQ(pickupService->GetPickups().size(), 0);
+    EXPECT_EQ(pickupService->GetPickupPoints(), 8);
+}
+
+TEST_F(PickupServiceTest, SweptCollectionLeavesPickupsOffThePath) {
+    pickupService->SpawnPointPickups(Position{200.0f, 300.0f}, 6, 1);
+    pickupService->SpawnPointPickups(Position{200.0f, 500.0f}, 6, 1);
+    pickupService->Update(GameConfig::PICKUP_COLLECT_DELAY + 0.01f);
+
+    std::vector<PointPickup> collected;
+    pickupService->ProcessPickupCollection(0.0f, 300.0f, 400.0f, 300.0f, 80.0f, collected);
+
+    EXPECT_EQ(collected.size(), 6);
+    ASSERT_EQ(pickupService->GetPickups().size(), 6);
+    for (const PointPickup& pickup : pickupService->GetPickups()) {
+        EXPECT_GT(pickup.position.y, 400.0f);
+    }
+}
+
+TEST_F(PickupServiceTest, SweptCollectionSeesPickupsSpawnedAfterTheLastSweep) {
+    pickupService->SpawnPointPickups(Position{200.0f, 300.0f}, 6, 1);
+    pickupService->Update(GameConfig::PICKUP_COLLECT_DELAY + 0.01f);
+
+    std::vector<PointPickup> collected;
+    pickupService->ProcessPickupCollection(0.0f, 300.0f, 400.0f, 300.0f, 80.0f, collected);
+    EXPECT_EQ(collected.size(), 6);
+
+    // Same sweep again: the index must drop what was collected and pick up the new burst
+    pickupService->SpawnPointPickups(Position{300.0f, 300.0f}, 4, 1);
+    pickupService->Update(GameConfig::PICKUP_COLLECT_DELAY + 0.01f);
+    pickupService->ProcessPickupCollection(0.0f, 300.0f, 400.0f, 300.0f, 80.0f, collected);
+    EXPECT_EQ(collected.size(), 4);
+    EXPECT_EQ(pickupService->GetPickupPoints(), 10);
+
+    pickupService->SpawnPointPickups(Position{100.0f, 300.0f}, 3, 1);
+    pickupService->Update(GameConfig::PICKUP_LIFETIME + 0.01f);
+    pickupService->ProcessPickupCollection(0.0f, 300.0f, 400.0f, 300.0f, 80.0f, collected);
+    EXPECT_EQ(collected.size(), 0);
+    EXPECT_EQ(pickupService->GetPickups().size(), 0);
+}
+
+TEST(FastMathTest, SinCosStaysWithinErrorBound) {
+    std::vector<float> angles;
+    for (int i = -200000; i <= 200000; ++i) {
+        angles.push_back(i * 0.005f);
+    }
+
+    std::vector<float> sines(angles.size());
+    std::vector<float> cosines(angles.size());
+    FastMath::SinCos(angles.data(), sines.data(), cosines.data(), angles.size());
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < angles.size(); ++i) {
+        maxError = std::max(maxError, static_cast<float>(std::fabs(sines[i] - std::sin(static_cast<double>(angles[i])))));
+        maxError = std::max(maxError, static_cast<float>(std::fabs(cosines[i] - std::cos(static_cast<double>(angles[i])))));
+    }
+
+    EXPECT_LE(maxError, FastMath::SINCOS_MAX_ERROR);
+}
+
+TEST_F(PickupServiceTest, BulkBurstsFillRingsAroundEachOrigin) {
+    std::vector<PickupBurst> bursts = {
+        PickupBurst{Position{100.0f, 100.0f}, 2000, 1},
+        PickupBurst{Position{500.0f, 400.0f}, 3000, 3},
+    };
+
+    pickupService->SpawnPickupBursts(bursts);
+
+    const auto& pickups = pickupService->GetPickups();
+    ASSERT_EQ(pickups.size(), 5000);
+
+    for (size_t i = 0; i < pickups.size(); ++i) {
+        const PointPickup& pickup = pickups[i];
+        const PickupBurst& burst = i < 2000 ? bursts[0] : bursts[1];
+        float dx = pickup.position.x - burst.origin.x;
+        float dy = pickup.position.y - burst.origin.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+
+        EXPECT_EQ(pickup.id, static_cast<int>(i));
+        EXPECT_EQ(pickup.points, burst.pointValue);
+        EXPECT_GE(distance, 600.0f * 0.0125f - 0.01f);
+        EXPECT_LE(distance, 600.0f * 0.05f + 0.01f);
+    }
+}
+
+TEST_F(PickupServiceTest, ConsolidationPreservesTotalPoints) {
+    pickupService->SetMergeThreshold(100);
+    for (int i = 0; i < 60; ++i) {
+        pickupService->SpawnPointPickups(Position{300.0f + (i % 3) * 5.0f, 300.0f}, 10, 2);
+    }
+
+    int totalBefore = 0;
+    for (const PointPickup& pickup : pickupService->GetPickups()) {
+        totalBefore += pickup.points;
+    }
+
+    pickupService->Update(GameConfig::PICKUP_MERGE_MIN_AGE);
+
+    const auto& pickups = pickupService->GetPickups();
+    int totalAfter = 0;
+    for (const PointPickup& pickup : pickups) {
+        totalAfter += pickup.points;
+    }
+
+    EXPECT_LT(pickups.size(), 600);
+    EXPECT_EQ(totalAfter, totalBefore);
+}
+
+TEST_F(PickupServiceTest, NoConsolidationBelowThreshold) {
+    pickupService->SpawnPointPickups(Position{300.0f, 300.0f}, 20, 1);
+    pickupService->Update(GameConfig::PICKUP_MERGE_MIN_AGE);
+
+    EXPECT_EQ(pickupService->GetPickups().size(), 20);
+}
+
 class DamageZoneServiceTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -233,3 +367,241 @@ TEST_F(DamageZoneServiceTest, MultipleNodesCanTakeDamage) {
     EXPECT_LT(node1->GetHP(), 100.0f);
     EXPECT_LT(node2->GetHP(), 100.0f);
 }
+
+TEST_F(DamageZoneServiceTest, MultipleZonesResolveInOnePass) {
+    auto left = std::make_unique<Node>(NodeShape::Circle, 30.0f, 0.0f);
+    left->SetHP(100.0f);
+    left->Spawn(100.0f, 300.0f);
+
+    auto right = std::make_unique<Node>(NodeShape::Circle, 30.0f, 0.0f);
+    right->SetHP(100.0f);
+    right->Spawn(700.0f, 300.0f);
+
+    std::vector<Node*> nodes = {left.get(), right.get()};
+    std::vector<DamageZone> zones = {
+        DamageZone{100.0f, 300.0f, 80.0f, 10.0f},
+        DamageZone{700.0f, 300.0f, 80.0f, 25.0f, 0.0f},
+    };
+
+    std::vector<size_t> hitZones;
+    std::vector<float> healthCosts;
+    damageZoneService->ProcessDamageZones(zones, 1, nodes, [&](Node*, float healthCost, size_t zoneIndex) {
+        hitZones.push_back(zoneIndex);
+        healthCosts.push_back(healthCost);
+    });
+
+    ASSERT_EQ(hitZones.size(), 2);
+    EXPECT_EQ(hitZones[0], 0);
+    EXPECT_EQ(hitZones[1], 1);
+    EXPECT_GT(healthCosts[0], 0.0f);
+    EXPECT_FLOAT_EQ(healthCosts[1], 0.0f);
+    EXPECT_FLOAT_EQ(left->GetHP(), 90.0f);
+    EXPECT_FLOAT_EQ(right->GetHP(), 75.0f);
+}
+
+TEST_F(DamageZoneServiceTest, OverlappingZonesStackUnlessGrouped) {
+    auto node = std::make_unique<Node>(NodeShape::Circle, 30.0f, 0.0f);
+    node->SetHP(100.0f);
+    node->Spawn(400.0f, 300.0f);
+    std::vector<Node*> nodes = {node.get()};
+
+    std::vector<DamageZone> stacking = {
+        DamageZone{400.0f, 300.0f, 80.0f, 10.0f},
+        DamageZone{410.0f, 300.0f, 80.0f, 10.0f},
+    };
+    damageZoneService->ProcessDamageZones(stacking, 1, nodes, nullptr);
+    EXPECT_FLOAT_EQ(node->GetHP(), 80.0f);
+
+    std::vector<DamageZone> grouped = {
+        DamageZone{400.0f, 300.0f, 80.0f, 10.0f, 1.0f, 3},
+        DamageZone{410.0f, 300.0f, 80.0f, 10.0f, 1.0f, 3},
+        DamageZone{420.0f, 300.0f, 80.0f, 5.0f, 1.0f, 4},
+    };
+    int hits = 0;
+    damageZoneService->ProcessDamageZones(grouped, 1, nodes, [&](Node*, float, size_t) { hits++; });
+    EXPECT_EQ(hits, 2);
+    EXPECT_FLOAT_EQ(node->GetHP(), 65.0f);
+}
+
+static ZoneGeometry::ZoneFrame MakeShapedFrame(DamageZoneShape shape, float size, float innerSize = 0.0f,
+                                               float rotation = 0.0f, float spreadAngle = 90.0f) {
+    DamageZone zone{0.0f, 0.0f, size, 1.0f};
+    zone.shape = shape;
+    zone.innerSize = innerSize;
+    zone.rotation = rotation;
+    zone.spreadAngle = spreadAngle;
+    return ZoneGeometry::MakeFrame(zone);
+}
+
+// Axis-aligned square node with half extent 10
+static ZoneGeometry::NodeOutline SquareNodeAt(float x, float y) {
+    return ZoneGeometry::NodeOutline{x, y, 14.142f, 4, 45.0f};
+}
+
+TEST(ZoneGeometryTest, NarrowPhaseUsesTrueNodeOutline) {
+    DamageZone zone{22.0f, 0.0f, 20.0f, 1.0f};
+    zone.shape = DamageZoneShape::Circle;
+    ZoneGeometry::ZoneFrame frame = ZoneGeometry::MakeFrame(zone);
+
+    // The bounding circle reaches the zone, the square's edge at x = 10 does not
+    float x = 0.0f, y = 0.0f, radius = 14.142f;
+    uint8_t broadHit = 0;
+    ZoneGeometry::BroadPhase(frame, &x, &y, &radius, &broadHit, 1);
+    EXPECT_EQ(broadHit, 1);
+    EXPECT_FALSE(ZoneGeometry::Intersects(frame, SquareNodeAt(0.0f, 0.0f)));
+    EXPECT_TRUE(ZoneGeometry::Intersects(frame, SquareNodeAt(3.0f, 0.0f)));
+}
+
+TEST(ZoneGeometryTest, RingSparesNodesInsideTheHole) {
+    ZoneGeometry::ZoneFrame ring = MakeShapedFrame(DamageZoneShape::Ring, 200.0f, 120.0f);
+
+    EXPECT_FALSE(ZoneGeometry::Intersects(ring, SquareNodeAt(0.0f, 0.0f)));
+    EXPECT_FALSE(ZoneGeometry::Intersects(ring, ZoneGeometry::NodeOutline{20.0f, 0.0f, 10.0f, 0, 0.0f}));
+    EXPECT_TRUE(ZoneGeometry::Intersects(ring, SquareNodeAt(80.0f, 0.0f)));
+    EXPECT_TRUE(ZoneGeometry::Intersects(ring, ZoneGeometry::NodeOutline{0.0f, -55.0f, 10.0f, 0, 0.0f}));
+    EXPECT_FALSE(ZoneGeometry::Intersects(ring, SquareNodeAt(0.0f, 150.0f)));
+}
+
+TEST(ZoneGeometryTest, ConeHitsOnlyAlongItsDirection) {
+    ZoneGeometry::ZoneFrame cone = MakeShapedFrame(DamageZoneShape::Cone, 100.0f, 0.0f, 90.0f, 60.0f);
+
+    EXPECT_TRUE(ZoneGeometry::Intersects(cone, SquareNodeAt(0.0f, 60.0f)));
+    EXPECT_TRUE(ZoneGeometry::Intersects(cone, ZoneGeometry::NodeOutline{0.0f, 105.0f, 10.0f, 0, 0.0f}));
+    EXPECT_FALSE(ZoneGeometry::Intersects(cone, SquareNodeAt(0.0f, -60.0f)));
+    EXPECT_FALSE(ZoneGeometry::Intersects(cone, SquareNodeAt(60.0f, 20.0f)));
+    EXPECT_FALSE(ZoneGeometry::Intersects(cone, ZoneGeometry::NodeOutline{0.0f, 125.0f, 10.0f, 0, 0.0f}));
+}
+
+TEST(ZoneGeometryTest, RectangleFollowsItsRotation) {
+    ZoneGeometry::ZoneFrame bar = MakeShapedFrame(DamageZoneShape::Rectangle, 200.0f, 20.0f, 90.0f);
+
+    EXPECT_TRUE(ZoneGeometry::Intersects(bar, SquareNodeAt(0.0f, 90.0f)));
+    EXPECT_FALSE(ZoneGeometry::Intersects(bar, SquareNodeAt(90.0f, 0.0f)));
+    EXPECT_TRUE(ZoneGeometry::Intersects(bar, ZoneGeometry::NodeOutline{15.0f, -50.0f, 6.0f, 6, 0.0f}));
+}
+
+TEST(ZoneGeometryTest, BroadPhaseNeverRejectsAHit) {
+    const DamageZoneShape shapes[] = {DamageZoneShape::Square, DamageZoneShape::Circle, DamageZoneShape::Ring,
+                                      DamageZoneShape::Rectangle, DamageZoneShape::Cone};
+    uint32_t state = 12345;
+
+    for (DamageZoneShape shape : shapes) {
+        ZoneGeometry::ZoneFrame frame = MakeShapedFrame(shape, 120.0f, 50.0f, 30.0f, 240.0f);
+
+        std::vector<ZoneGeometry::NodeOutline> outlines;
+        std::vector<float> xs, ys, radii;
+        for (int i = 0; i < 2000; ++i) {
+            const int sides[] = {0, 4, 6};
+            ZoneGeometry::NodeOutline outline{FastMath::NextUnit(state) * 300.0f - 150.0f,
+                                              FastMath::NextUnit(state) * 300.0f - 150.0f,
+                                              5.0f + FastMath::NextUnit(state) * 20.0f, sides[i % 3],
+                                              FastMath::NextUnit(state) * 360.0f};
+            outlines.push_back(outline);
+            xs.push_back(outline.x);
+            ys.push_back(outline.y);
+            radii.push_back(outline.radius);
+        }
+
+        std::vector<uint8_t> hits(outlines.size());
+        ZoneGeometry::BroadPhase(frame, xs.data(), ys.data(), radii.data(), hits.data(), outlines.size());
+
+        int narrowHits = 0;
+        for (size_t i = 0; i < outlines.size(); ++i) {
+            if (ZoneGeometry::Intersects(frame, outlines[i])) {
+                narrowHits++;
+                EXPECT_EQ(hits[i], 1) << "shape " << static_cast<int>(shape) << " node " << i;
+            }
+        }
+        EXPECT_GT(narrowHits, 0);
+    }
+}
+
+TEST_F(DamageZoneServiceTest, ShapedZonesDamageThroughTheService) {
+    auto inHole = std::make_unique<Node>(NodeShape::Circle, 10.0f, 0.0f);
+    inHole->SetHP(100.0f);
+    inHole->Spawn(400.0f, 300.0f);
+
+    auto onBand = std::make_unique<Node>(NodeShape::Hexagon, 10.0f, 0.0f);
+    onBand->SetHP(100.0f);
+    onBand->Spawn(480.0f, 300.0f);
+
+    std::vector<Node*> nodes = {inHole.get(), onBand.get()};
+    DamageZone ring{400.0f, 300.0f, 200.0f, 10.0f};
+    ring.shape = DamageZoneShape::Ring;
+    ring.innerSize = 120.0f;
+
+    damageZoneService->ProcessDamageZones({ring}, 1, nodes, nullptr);
+
+    EXPECT_FLOAT_EQ(inHole->GetHP(), 100.0f);
+    EXPECT_FLOAT_EQ(onBand->GetHP(), 90.0f);
+}
+
+class ProjectileServiceTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        projectileService = std::make_unique<ProjectileService>();
+        projectileService->Initialize(800.0f, 600.0f);
+    }
+
+    std::unique_ptr<ProjectileService> projectileService;
+};
+
+TEST_F(ProjectileServiceTest, RadialBurstSpreadsEvenly) {
+    EXPECT_EQ(projectileService->FireRadial(Position{400.0f, 300.0f}, 8, 100.0f, 0.0f), 8);
+    EXPECT_EQ(projectileService->GetActiveCount(), 8u);
+
+    projectileService->Update(0.5f);
+
+    const float* xs = projectileService->GetXs();
+    const float* ys = projectileService->GetYs();
+    for (size_t i = 0; i < projectileService->GetSlotCount(); ++i) {
+        float dx = xs[i] - 400.0f;
+        float dy = ys[i] - 300.0f;
+        EXPECT_NEAR(std::sqrt(dx * dx + dy * dy), 50.0f, 0.1f);
+    }
+}
+
+TEST_F(ProjectileServiceTest, PoolStopsAtCapacityAndRecyclesSlots) {
+    int fired = 0;
+    for (int i = 0; i < GameConfig::PROJECTILE_CAPACITY + 10; ++i) {
+        fired += projectileService->Fire(400.0f, 300.0f, 0.0f, 0.0f, 1.0f) ? 1 : 0;
+    }
+    EXPECT_EQ(fired, GameConfig::PROJECTILE_CAPACITY);
+
+    EXPECT_EQ(projectileService->ProcessHits(400.0f, 300.0f, 10.0f), GameConfig::PROJECTILE_CAPACITY);
+    EXPECT_EQ(projectileService->GetActiveCount(), 0u);
+    EXPECT_TRUE(projectileService->Fire(400.0f, 300.0f, 0.0f, 0.0f, 1.0f));
+}
+
+TEST_F(ProjectileServiceTest, LifetimeExpiresOnTheWheel) {
+    projectileService->Fire(400.0f, 300.0f, 0.0f, 0.0f, 0.5f);
+    projectileService->Fire(400.0f, 300.0f, 0.0f, 0.0f, 2.0f);
+
+    for (int i = 0; i < 40; ++i) {
+        projectileService->Update(1.0f / 60.0f);
+    }
+    EXPECT_EQ(projectileService->GetActiveCount(), 1u);
+
+    for (int i = 0; i < 100; ++i) {
+        projectileService->Update(1.0f / 60.0f);
+    }
+    EXPECT_EQ(projectileService->GetActiveCount(), 0u);
+}
+
+TEST_F(ProjectileServiceTest, ReusedSlotIgnoresStaleExpiry) {
+    projectileService->Fire(100.0f, 100.0f, 0.0f, 0.0f, 0.25f);
+    EXPECT_EQ(projectileService->ProcessHits(100.0f, 100.0f, 10.0f), 1);
+
+    // Takes the released slot; the first projectile's wheel entry must not expire it
+    projectileService->Fire(400.0f, 300.0f, 0.0f, 0.0f, 2.0f);
+    for (int i = 0; i < 30; ++i) {
+        projectileService->Update(1.0f / 60.0f);
+    }
+    EXPECT_EQ(projectileService->GetActiveCount(), 1u);
+}
+
+TEST_F(ProjectileServiceTest, OffscreenProjectilesAreCulled) {
+    projectileService->Fire(790.0f, 300.0f, 600.0f, 0.0f, GameConfig::PROJECTILE_LIFETIME);
+    projectileService->Update(0.2f);
+    EXPECT_EQ(projectileService->GetActiveCount(), 0u);
+}
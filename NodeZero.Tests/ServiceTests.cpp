@@ -1,8 +1,23 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "../NodeZero.Core/src/Services/CheckpointService.h"
 #include "../NodeZero.Core/src/Services/HealthService.h"
 #include "../NodeZero.Core/src/Services/UpgradeService.h"
 #include "../NodeZero.Core/src/Services/SaveService.h"
+#include "../NodeZero.Core/src/Services/InMemoryRunHistoryService.h"
+#include "../NodeZero.Core/src/Services/InMemorySaveService.h"
+#include "../NodeZero.Core/src/Services/RandomService.h"
+#include "../NodeZero.Core/src/Services/RewindService.h"
+#include "../NodeZero.Core/src/Services/RunHistoryService.h"
+#include "../NodeZero.Core/src/Storage/CheckpointFormat.h"
+#include "../NodeZero.Core/src/Storage/RunHistoryFormat.h"
 #include "../NodeZero.Core/include/Config/GameConfig.h"
 #include "../NodeZero.Core/include/Types/SaveData.h"
 
@@ -155,4 +170,363 @@ TEST_F(SaveServiceTest, SaveAndLoadData) {
     EXPECT_EQ(loadedData.currentLevel, 7);
     EXPECT_FLOAT_EQ(loadedData.maxHealth, 75.0f);
     EXPECT_FLOAT_EQ(loadedData.regenRate, 5.0f);
-}
\ No newline at end of file
+}
+class InMemorySaveServiceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SaveData initialData;
+        initialData.points = 250;
+        initialData.currentLevel = 3;
+        saveService = std::make_unique<InMemorySaveService>(initialData);
+    }
+    std::unique_ptr<InMemorySaveService> saveService;
+};
+
+TEST_F(InMemorySaveServiceTest, StartsWithInitialData) {
+    EXPECT_EQ(saveService->GetPoints(), 250);
+    EXPECT_EQ(saveService->LoadProgress().currentLevel, 3);
+}
+
+TEST_F(InMemorySaveServiceTest, SaveAndLoadRoundTrip) {
+    SaveData data;
+    data.points = 42;
+    data.highPoints = 900;
+    data.damageZoneSize = 120.0f;
+
+    saveService->SaveProgress(data);
+    SaveData loadedData = saveService->LoadProgress();
+
+    EXPECT_EQ(loadedData.points, 42);
+    EXPECT_EQ(loadedData.highPoints, 900);
+    EXPECT_FLOAT_EQ(loadedData.damageZoneSize, 120.0f);
+    EXPECT_EQ(saveService->GetHighPoints(), 900);
+}
+
+TEST(RandomServiceTest, SameSeedGivesSameSequence) {
+    RandomService first(1234);
+    RandomService second(1234);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(first.NextInt(1000), second.NextInt(1000));
+        EXPECT_FLOAT_EQ(first.NextFloat(), second.NextFloat());
+    }
+}
+
+TEST(RandomServiceTest, ValuesStayInRange) {
+    RandomService random(7);
+
+    for (int i = 0; i < 1000; ++i) {
+        int value = random.NextInt(6);
+        EXPECT_GE(value, 0);
+        EXPECT_LT(value, 6);
+
+        float ranged = random.Range(-2.0f, 3.0f);
+        EXPECT_GE(ranged, -2.0f);
+        EXPECT_LE(ranged, 3.0f);
+    }
+}
+
+// A field of nodes drifting right, with one spawned every frame and every seventh one
+// removed from the middle, so frames differ in both values and counts.
+static WorldSnapshot MakeRewindFrame(int frame) {
+    WorldSnapshot snapshot;
+    snapshot.simTime = frame * 0.1;
+    snapshot.tick = static_cast<uint64_t>(frame);
+    snapshot.health = 100.0f - frame * 0.25f;
+    snapshot.maxHealth = 100.0f;
+    snapshot.level = 2;
+    snapshot.levelCompleted = frame % 50 == 49;
+
+    for (int id = 0; id < 200 + frame; ++id) {
+        if (id % 7 == frame % 7) {
+            continue;
+        }
+        float x = 10.0f + id * 3.0f + frame * 1.5f;
+        snapshot.nodes.push_back(NodeSnapshot{id, x, 300.0f + id % 13, 12.0f, 40.0f - (frame % 5), 40.0f,
+                                              frame * 4.0f, static_cast<NodeShape>(id % 3)});
+    }
+    for (int i = 0; i < frame % 11; ++i) {
+        snapshot.pickups.push_back(PickupSnapshot{Position{50.0f * i, 60.0f}, Position{0.0f, 0.0f}, 6.0f,
+                                                  frame * 0.1f, 0.5f, i + 1});
+    }
+    snapshot.projectileXs.assign(frame % 4, 5.0f + frame);
+    snapshot.projectileYs.assign(frame % 4, 7.0f);
+    return snapshot;
+}
+
+static void ExpectSameFrame(const WorldSnapshot& expected, const WorldSnapshot& actual) {
+    EXPECT_EQ(expected.tick, actual.tick);
+    EXPECT_EQ(expected.simTime, actual.simTime);
+    EXPECT_EQ(expected.health, actual.health);
+    EXPECT_EQ(expected.levelCompleted, actual.levelCompleted);
+    ASSERT_EQ(expected.nodes.size(), actual.nodes.size());
+    for (size_t i = 0; i < expected.nodes.size(); ++i) {
+        EXPECT_EQ(expected.nodes[i].id, actual.nodes[i].id);
+        EXPECT_EQ(expected.nodes[i].x, actual.nodes[i].x);
+        EXPECT_EQ(expected.nodes[i].hp, actual.nodes[i].hp);
+        EXPECT_EQ(expected.nodes[i].rotation, actual.nodes[i].rotation);
+        EXPECT_EQ(expected.nodes[i].shape, actual.nodes[i].shape);
+    }
+    ASSERT_EQ(expected.pickups.size(), actual.pickups.size());
+    for (size_t i = 0; i < expected.pickups.size(); ++i) {
+        EXPECT_EQ(expected.pickups[i].position.x, actual.pickups[i].position.x);
+        EXPECT_EQ(expected.pickups[i].points, actual.pickups[i].points);
+    }
+    EXPECT_EQ(expected.projectileXs, actual.projectileXs);
+    EXPECT_EQ(expected.projectileYs, actual.projectileYs);
+}
+
+TEST(RewindServiceTest, StepsBackAndForthThroughExactFrames) {
+    RewindService rewind;
+    rewind.SetEnabled(true);
+
+    const int frameCount = 2 * GameConfig::REWIND_KEYFRAME_INTERVAL + 10;
+    for (int frame = 0; frame < frameCount; ++frame) {
+        rewind.Record(MakeRewindFrame(frame));
+    }
+    ASSERT_EQ(rewind.GetFrameCount(), static_cast<size_t>(frameCount));
+
+    WorldSnapshot decoded;
+    for (int frame = frameCount - 1; frame >= 0; --frame) {
+        ASSERT_TRUE(rewind.ReadFrame(decoded));
+        ExpectSameFrame(MakeRewindFrame(frame), decoded);
+        EXPECT_EQ(rewind.StepBackward(), frame > 0);
+    }
+    EXPECT_NEAR(rewind.GetSecondsBack(), (frameCount - 1) * 0.1, 1e-9);
+
+    for (int frame = 1; frame < frameCount; ++frame) {
+        ASSERT_TRUE(rewind.StepForward());
+        ASSERT_TRUE(rewind.ReadFrame(decoded));
+        ExpectSameFrame(MakeRewindFrame(frame), decoded);
+    }
+    EXPECT_FALSE(rewind.StepForward());
+}
+
+TEST(RewindServiceTest, UnchangedFramesCostOnlyTheirTags) {
+    RewindService rewind;
+    rewind.SetEnabled(true);
+
+    WorldSnapshot snapshot = MakeRewindFrame(30);
+    rewind.Record(snapshot);
+    size_t keyframeBytes = rewind.GetMemoryUsage();
+    snapshot.simTime += 0.1;
+    rewind.Record(snapshot);
+    size_t diffBytes = rewind.GetMemoryUsage() - keyframeBytes;
+
+    size_t words = 20 + 8 * snapshot.nodes.size() + 8 * snapshot.pickups.size() + 2 * snapshot.projectileXs.size();
+    EXPECT_LE(diffBytes, words / 4 + 16);
+    EXPECT_LT(keyframeBytes, words * 4);
+}
+
+TEST(RewindServiceTest, KeepsTheWindowAndDropsWholeGroups) {
+    RewindService rewind;
+    rewind.SetEnabled(true);
+
+    // 0.1 s frames for 40 s, four times the window
+    for (int frame = 0; frame < 400; ++frame) {
+        WorldSnapshot snapshot = MakeRewindFrame(frame % 100);
+        snapshot.simTime = frame * 0.1;
+        rewind.Record(snapshot);
+    }
+
+    while (rewind.StepBackward()) {
+    }
+    double groupSeconds = GameConfig::REWIND_KEYFRAME_INTERVAL * 0.1;
+    EXPECT_GE(rewind.GetSecondsBack(), GameConfig::REWIND_WINDOW - 1e-6);
+    EXPECT_LT(rewind.GetSecondsBack(), GameConfig::REWIND_WINDOW + groupSeconds);
+
+    WorldSnapshot decoded;
+    ASSERT_TRUE(rewind.ReadFrame(decoded));
+    EXPECT_EQ(decoded.tick, static_cast<uint64_t>((400 - rewind.GetFrameCount()) % 100));
+}
+
+TEST(RewindServiceTest, RecordsNothingUntilEnabled) {
+    RewindService rewind;
+    rewind.Record(MakeRewindFrame(0));
+
+    WorldSnapshot decoded;
+    EXPECT_EQ(rewind.GetFrameCount(), 0u);
+    EXPECT_FALSE(rewind.ReadFrame(decoded));
+
+    rewind.SetEnabled(true);
+    rewind.Record(MakeRewindFrame(0));
+    rewind.SetEnabled(false);
+    EXPECT_EQ(rewind.GetFrameCount(), 0u);
+}
+
+static Checkpoint MakeTestCheckpoint() {
+    Checkpoint checkpoint;
+    checkpoint.world = WorldCheckpoint{};
+    checkpoint.world.simTime = 12.5;
+    checkpoint.world.randomState = 0x1234567890ABCDEFull;
+    checkpoint.world.bossId = -1;
+    checkpoint.world.level.level = 3;
+    checkpoint.world.health.currentHealth = 42.0f;
+    checkpoint.world.spawn.scheduleCursor = 7;
+    checkpoint.world.pickups.pickupPoints = 99;
+
+    for (int i = 0; i < 3; ++i) {
+        NodeCheckpoint node{};
+        node.id = i + 10;
+        node.originX = 100.0f * i;
+        node.hp = 5.0f + i;
+        node.startTime = 0.25 * i;
+        checkpoint.nodes.push_back(node);
+    }
+    PointPickup pickup;
+    pickup.id = 4;
+    pickup.position = Position{1.0f, 2.0f};
+    pickup.points = 6;
+    checkpoint.pickups.push_back(pickup);
+    return checkpoint;
+}
+
+TEST(CheckpointServiceTest, WritesInTheBackgroundAndReadsBackWhole) {
+    std::string path = ::testing::TempDir() + "nodezero_checkpoint_test.dat";
+    std::remove(path.c_str());
+
+    {
+        CheckpointService service(path);
+        EXPECT_FALSE(service.HasCheckpoint());
+        Checkpoint checkpoint = MakeTestCheckpoint();
+        service.Submit(checkpoint);
+        EXPECT_TRUE(service.HasCheckpoint());
+        service.Flush();
+    }
+
+    CheckpointService reopened(path);
+    ASSERT_TRUE(reopened.HasCheckpoint());
+    Checkpoint loaded;
+    ASSERT_TRUE(reopened.Load(loaded));
+    EXPECT_EQ(loaded.world.simTime, 12.5);
+    EXPECT_EQ(loaded.world.randomState, 0x1234567890ABCDEFull);
+    EXPECT_EQ(loaded.world.level.level, 3);
+    EXPECT_EQ(loaded.world.spawn.scheduleCursor, 7u);
+    ASSERT_EQ(loaded.nodes.size(), 3u);
+    EXPECT_EQ(loaded.nodes[2].id, 12);
+    EXPECT_FLOAT_EQ(loaded.nodes[2].originX, 200.0f);
+    EXPECT_EQ(loaded.nodes[2].startTime, 0.5);
+    ASSERT_EQ(loaded.pickups.size(), 1u);
+    EXPECT_EQ(loaded.pickups[0].points, 6);
+
+    reopened.Discard();
+    reopened.Flush();
+    EXPECT_FALSE(reopened.HasCheckpoint());
+    EXPECT_FALSE(reopened.Load(loaded));
+}
+
+TEST(CheckpointServiceTest, RefusesATornOrCorruptFile) {
+    std::vector<uint8_t> bytes;
+    CheckpointFormat::Write(MakeTestCheckpoint(), bytes);
+    Checkpoint loaded;
+    ASSERT_TRUE(CheckpointFormat::Read(bytes.data(), bytes.size(), loaded));
+    EXPECT_FALSE(CheckpointFormat::Read(bytes.data(), bytes.size() - 8, loaded));
+
+    std::vector<uint8_t> corrupt = bytes;
+    corrupt[corrupt.size() - 1] ^= 0x01;
+    EXPECT_FALSE(CheckpointFormat::Read(corrupt.data(), corrupt.size(), loaded));
+
+    std::string path = ::testing::TempDir() + "nodezero_torn_checkpoint_test.dat";
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size() / 2));
+    }
+    CheckpointService service(path);
+    EXPECT_FALSE(service.HasCheckpoint());
+    EXPECT_FALSE(service.Load(loaded));
+    std::remove(path.c_str());
+}
+
+static RunRecord MakeTestRun(uint32_t index) {
+    RunRecord run;
+    run.levelReached = 1 + index % 40;
+    run.durationMilliseconds = 30000 + index * 17;
+    run.points = (index * 7919u) % 100000u;
+    run.nodesDestroyed = index % 500;
+    run.upgrades = index / 100;
+    return run;
+}
+
+TEST(RunHistoryServiceTest, AppendsAcrossBlocksAndReopensFromTheFile) {
+    std::string path = ::testing::TempDir() + "nodezero_history_test.dat";
+    std::remove(path.c_str());
+    const uint32_t runCount = static_cast<uint32_t>(RunHistoryFormat::BLOCK_RUNS * 2 + 100);
+
+    {
+        RunHistoryService history(path);
+        ASSERT_TRUE(history.IsPersistent());
+        EXPECT_EQ(history.GetRunCount(), 0u);
+        EXPECT_EQ(history.GetPercentile(RunStat::Points, 0.5f), 0.0);
+        for (uint32_t i = 0; i < runCount; ++i) {
+            history.Append(MakeTestRun(i));
+        }
+    }
+
+    RunHistoryService history(path);
+    ASSERT_TRUE(history.IsPersistent());
+    ASSERT_EQ(history.GetRunCount(), runCount);
+    for (uint32_t i : {0u, 1023u, 1024u, runCount - 1}) {
+        RunRecord run = history.GetRun(i);
+        RunRecord expected = MakeTestRun(i);
+        EXPECT_EQ(run.levelReached, expected.levelReached);
+        EXPECT_EQ(run.durationMilliseconds, expected.durationMilliseconds);
+        EXPECT_EQ(run.points, expected.points);
+        EXPECT_EQ(run.nodesDestroyed, expected.nodesDestroyed);
+        EXPECT_EQ(run.upgrades, expected.upgrades);
+    }
+
+    // Averages come from running totals, across a block boundary too
+    double sum = 0.0;
+    for (uint32_t i = 1000; i < 1100; ++i) {
+        sum += MakeTestRun(i).points;
+    }
+    EXPECT_DOUBLE_EQ(history.GetAverage(RunStat::Points, 1000, 100), sum / 100.0);
+    EXPECT_DOUBLE_EQ(history.GetAverage(RunStat::Duration, 0, 1), 30.0);
+    EXPECT_DOUBLE_EQ(history.GetAverage(RunStat::LevelReached, runCount - 1, 50),
+                     static_cast<double>(MakeTestRun(runCount - 1).levelReached));
+    EXPECT_EQ(history.GetAverage(RunStat::Points, runCount, 10), 0.0);
+
+    // Levels sit in the exact buckets: 1 to 40, evenly
+    EXPECT_EQ(history.GetPercentile(RunStat::LevelReached, 0.0f), 1.0);
+    EXPECT_EQ(history.GetPercentile(RunStat::LevelReached, 1.0f), 40.0);
+    EXPECT_NEAR(history.GetPercentile(RunStat::LevelReached, 0.5f), 20.0, 1.0);
+    std::remove(path.c_str());
+}
+
+TEST(RunHistoryServiceTest, PercentilesStayWithinABucketOfExact) {
+    InMemoryRunHistoryService history;
+    std::vector<uint32_t> points;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        RunRecord run = MakeTestRun(i);
+        history.Append(run);
+        points.push_back(run.points);
+    }
+    std::sort(points.begin(), points.end());
+
+    for (float fraction : {0.1f, 0.5f, 0.9f, 0.99f}) {
+        double exact = points[static_cast<size_t>(std::ceil(fraction * points.size())) - 1];
+        EXPECT_NEAR(history.GetPercentile(RunStat::Points, fraction), exact, exact / 16.0 + 1.0) << fraction;
+    }
+    EXPECT_FALSE(history.IsPersistent());
+}
+
+TEST(RunHistoryServiceTest, LeavesAForeignFileAlone) {
+    std::string path = ::testing::TempDir() + "nodezero_foreign_history_test.dat";
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << "not a run history";
+    }
+
+    {
+        RunHistoryService history(path);
+        EXPECT_FALSE(history.IsPersistent());
+        history.Append(MakeTestRun(3));
+        EXPECT_EQ(history.GetRunCount(), 1u);
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(contents, "not a run history");
+    file.close();
+    std::remove(path.c_str());
+}
@@ -0,0 +1,439 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../NodeZero.Core/src/Game.h"
+#include "../NodeZero.Core/src/Simulation/AutoPlayer.h"
+#include "../NodeZero.Core/src/Simulation/BatchSimulator.h"
+#include "../NodeZero.Core/src/Simulation/SimulationThread.h"
+#include "../NodeZero.Core/src/Simulation/SpscQueue.h"
+#include "../NodeZero.Core/src/Simulation/ThreadPool.h"
+#include "../NodeZero.Core/src/Simulation/TripleBuffer.h"
+#include "../NodeZero.Core/src/Spatial/SpatialGrid.h"
+#include "../NodeZero.Core/include/Services/GameServices.h"
+#include "../NodeZero.Core/include/Services/IHealthService.h"
+#include "../NodeZero.Core/include/Services/IUpgradeService.h"
+#include "../NodeZero.Core/include/Types/SimulationReport.h"
+
+static SpawnInfo CreateTestSpawnInfo(float x, float y) {
+    SpawnInfo info;
+    info.position = Position{x, y};
+    info.shape = NodeShape::Circle;
+    info.directionX = 0.0f;
+    info.directionY = 0.0f;
+    return info;
+}
+
+TEST(ThreadPoolTest, RunsAllSubmittedTasks) {
+    ThreadPool pool(4);
+    std::atomic<int> counter{0};
+
+    for (int i = 0; i < 1000; ++i) {
+        pool.Submit([&counter]() { counter++; });
+    }
+    pool.WaitIdle();
+
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPoolTest, TaskExceptionsReachWaitIdle) {
+    ThreadPool pool(2);
+    std::atomic<int> counter{0};
+
+    pool.Submit([]() { throw std::runtime_error("balance run failed"); });
+    for (int i = 0; i < 100; ++i) {
+        pool.Submit([&counter]() { counter++; });
+    }
+    EXPECT_THROW(pool.WaitIdle(), std::runtime_error);
+    EXPECT_EQ(counter.load(), 100);
+
+    // The error is reported once and the workers keep going
+    pool.Submit([&counter]() { counter++; });
+    EXPECT_NO_THROW(pool.WaitIdle());
+    EXPECT_EQ(counter.load(), 101);
+}
+
+TEST(ThreadPoolTest, ParallelForRethrowsOnTheCaller) {
+    ThreadPool pool(3);
+    auto body = [](size_t begin, size_t) {
+        if (begin == 40) {
+            throw std::runtime_error("chunk failed");
+        }
+    };
+    EXPECT_THROW(pool.ParallelFor(100, 10, body), std::runtime_error);
+
+    std::atomic<size_t> covered{0};
+    pool.ParallelFor(100, 10, [&covered](size_t begin, size_t end) { covered += end - begin; });
+    EXPECT_EQ(covered.load(), 100u);
+}
+
+TEST(HistogramTest, BuildComputesSummary) {
+    Histogram histogram = Histogram::Build({1.0f, 2.0f, 3.0f, 4.0f, 10.0f}, 4);
+
+    EXPECT_EQ(histogram.sampleCount, 5);
+    EXPECT_FLOAT_EQ(histogram.minValue, 1.0f);
+    EXPECT_FLOAT_EQ(histogram.maxValue, 10.0f);
+    EXPECT_FLOAT_EQ(histogram.mean, 4.0f);
+    EXPECT_FLOAT_EQ(histogram.median, 3.0f);
+
+    int total = 0;
+    for (int count : histogram.buckets) {
+        total += count;
+    }
+    EXPECT_EQ(total, 5);
+}
+
+TEST(HistogramTest, BucketsAreEqualWidthIncludingTheTails) {
+    std::vector<float> samples;
+    for (int i = 0; i < 100; ++i) {
+        samples.push_back(static_cast<float>(i));
+    }
+    Histogram uniform = Histogram::Build(samples, 10);
+    for (int count : uniform.buckets) {
+        EXPECT_EQ(count, 10);
+    }
+
+    Histogram skewed = Histogram::Build({1.0f, 2.0f, 3.0f, 4.0f, 10.0f}, 4);
+    EXPECT_EQ(skewed.buckets, (std::vector<int>{3, 1, 0, 1}));
+}
+
+class BatchSimulatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        config.runsPerConfig = 4;
+        config.maxDuration = 20.0f;
+        config.timeStep = 1.0f / 30.0f;
+        config.threadCount = 2;
+    }
+    BatchSimulationConfig config;
+};
+
+TEST_F(BatchSimulatorTest, SingleRunIsDeterministicForSeed) {
+    SimulationRunResult first = BatchSimulator::RunSingle(config, 1, UpgradeConfig{}, 5);
+    SimulationRunResult second = BatchSimulator::RunSingle(config, 1, UpgradeConfig{}, 5);
+
+    EXPECT_FLOAT_EQ(first.survivalTime, second.survivalTime);
+    EXPECT_EQ(first.points, second.points);
+    EXPECT_EQ(first.nodesDestroyed, second.nodesDestroyed);
+}
+
+TEST_F(BatchSimulatorTest, SweepProducesOneReportPerCell) {
+    config.startLevels = {1, 3};
+    UpgradeConfig damageBuild;
+    damageBuild.damageUpgrades = 4;
+    config.upgradeConfigs = {UpgradeConfig{}, damageBuild};
+
+    BatchSimulator simulator(config);
+    std::vector<SweepCellReport> reports = simulator.Run();
+
+    ASSERT_EQ(reports.size(), 4);
+    for (const SweepCellReport& report : reports) {
+        EXPECT_EQ(report.runs.size(), 4);
+        EXPECT_EQ(report.survivalTime.sampleCount, 4);
+        for (const SimulationRunResult& run : report.runs) {
+            EXPECT_GT(run.survivalTime, 0.0f);
+            EXPECT_GE(run.levelReached, report.startLevel);
+        }
+    }
+}
+
+TEST_F(BatchSimulatorTest, CustomCursorPolicyIsUsed) {
+    int calls = 0;
+    config.maxDuration = 1.0f;
+    config.cursorPolicy = [&calls](IGame&, float) {
+        calls++;
+        return Position{0.0f, 0.0f};
+    };
+
+    BatchSimulator::RunSingle(config, 1, UpgradeConfig{}, 1);
+
+    EXPECT_GT(calls, 0);
+}
+
+TEST_F(BatchSimulatorTest, OverloadSamplesAtEachInterval) {
+    config.maxDuration = 6.0f;
+    config.cursorPolicy = [](IGame&, float) { return Position{0.0f, 0.0f}; };
+
+    std::vector<OverloadSample> samples = BatchSimulator::RunOverload(config, 3, 2.0f);
+
+    ASSERT_EQ(samples.size(), 3u);
+    EXPECT_NEAR(samples[0].simTime, 2.0f, config.timeStep);
+    EXPECT_NEAR(samples[2].simTime, 6.0f, config.timeStep);
+    EXPECT_GT(samples[2].liveNodes, 0u);
+    for (const OverloadSample& sample : samples) {
+        EXPECT_GE(sample.tickMilliseconds, 0.0);
+    }
+}
+
+TEST(TripleBufferTest, ReaderTakesNewestAndWriterSeesDrops) {
+    TripleBuffer<int> buffer;
+
+    EXPECT_FALSE(buffer.Acquire());
+
+    buffer.GetBack() = 1;
+    EXPECT_FALSE(buffer.Publish());
+    buffer.GetBack() = 2;
+    // 1 was never taken, so the writer gets it back
+    EXPECT_TRUE(buffer.Publish());
+    EXPECT_EQ(buffer.GetBack(), 1);
+
+    ASSERT_TRUE(buffer.Acquire());
+    EXPECT_EQ(buffer.GetFront(), 2);
+    EXPECT_FALSE(buffer.Acquire());
+    EXPECT_EQ(buffer.GetFront(), 2);
+}
+
+TEST(TripleBufferTest, ConcurrentReaderNeverSeesOlderValues) {
+    TripleBuffer<int> buffer;
+    const int lastValue = 200000;
+
+    std::thread writer([&buffer, lastValue]() {
+        for (int value = 1; value <= lastValue; ++value) {
+            buffer.GetBack() = value;
+            buffer.Publish();
+        }
+    });
+
+    int seen = 0;
+    bool ordered = true;
+    while (seen < lastValue) {
+        if (buffer.Acquire()) {
+            ordered = ordered && buffer.GetFront() > seen;
+            seen = buffer.GetFront();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    writer.join();
+
+    EXPECT_TRUE(ordered);
+}
+
+TEST(SpscQueueTest, RoundsCapacityUpAndRejectsWhenFull) {
+    SpscQueue<int> queue(5);
+    ASSERT_EQ(queue.GetCapacity(), 8u);
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(queue.TryPush(i));
+    }
+    EXPECT_FALSE(queue.TryPush(8));
+
+    int value = -1;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.TryPush(8));
+}
+
+TEST(SpscQueueTest, ConcurrentItemsArriveInOrder) {
+    SpscQueue<int> queue(64);
+    const int itemCount = 200000;
+
+    std::thread producer([&queue, itemCount]() {
+        for (int i = 0; i < itemCount; ++i) {
+            while (!queue.TryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    bool ordered = true;
+    while (expected < itemCount) {
+        int value;
+        if (queue.TryPop(value)) {
+            ordered = ordered && value == expected;
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+}
+
+class SimulationThreadTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        game = std::make_unique<Game>(GameServices::CreateInMemory(4));
+        game->Initialize(800.0f, 600.0f);
+        game->Reset();
+        simulation = std::make_unique<SimulationThread>(*game);
+        simulation->Start();
+    }
+
+    void TearDown() override {
+        simulation.reset();
+    }
+
+    // Takes snapshots until done(snapshot) holds, for at most two seconds.
+    template <typename Predicate>
+    bool WaitForSnapshot(Predicate done) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (simulation->AcquireSnapshot() && done(simulation->GetSnapshot())) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+
+    std::unique_ptr<Game> game;
+    std::unique_ptr<SimulationThread> simulation;
+};
+
+TEST_F(SimulationThreadTest, StartsPausedAndPublishesOnResume) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(simulation->AcquireSnapshot());
+
+    simulation->Resume();
+
+    ASSERT_TRUE(WaitForSnapshot([](const WorldSnapshot& snapshot) { return snapshot.tick >= 5; }));
+    EXPECT_FLOAT_EQ(simulation->GetSnapshot().maxHealth, game->GetUpgradeService().GetMaxHealth());
+}
+
+TEST_F(SimulationThreadTest, AppliesInputAndStopsTickingWhenPaused) {
+    simulation->PushInput(SimulationInput{123.0f, 456.0f});
+    simulation->Resume();
+    ASSERT_TRUE(WaitForSnapshot([](const WorldSnapshot& snapshot) { return snapshot.tick >= 2; }));
+
+    simulation->Pause();
+    while (simulation->AcquireSnapshot()) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+    EXPECT_FALSE(simulation->AcquireSnapshot());
+    EXPECT_FLOAT_EQ(game->GetMousePosition().x, 123.0f);
+    EXPECT_FLOAT_EQ(game->GetMousePosition().y, 456.0f);
+}
+
+TEST_F(SimulationThreadTest, PausesItselfWhenHealthRunsOut) {
+    game->GetHealthService().Reduce(game->GetHealthService().GetCurrent());
+    simulation->Resume();
+
+    ASSERT_TRUE(WaitForSnapshot([](const WorldSnapshot& snapshot) { return snapshot.tick >= 1; }));
+    EXPECT_TRUE(simulation->GetSnapshot().healthDepleted);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_TRUE(simulation->IsPaused());
+    EXPECT_FALSE(simulation->AcquireSnapshot());
+}
+
+TEST(SpatialGridTest, QueryRectFindsEveryPointInside) {
+    std::vector<float> xs;
+    std::vector<float> ys;
+    for (int i = 0; i < 500; ++i) {
+        xs.push_back(static_cast<float>((i * 37) % 1000));
+        ys.push_back(static_cast<float>((i * 91) % 700));
+    }
+
+    SpatialGrid grid;
+    grid.Build(xs.data(), ys.data(), xs.size(), 50.0f);
+
+    std::vector<uint32_t> found;
+    grid.QueryRect(200.0f, 100.0f, 400.0f, 300.0f, [&found](uint32_t index) { found.push_back(index); });
+
+    for (size_t i = 0; i < xs.size(); ++i) {
+        bool inside = xs[i] >= 200.0f && xs[i] <= 400.0f && ys[i] >= 100.0f && ys[i] <= 300.0f;
+        if (inside) {
+            EXPECT_NE(std::find(found.begin(), found.end(), static_cast<uint32_t>(i)), found.end());
+        }
+    }
+}
+
+TEST(SpatialGridTest, NeighborQueryCoversAdjacentCellsAndStopsAtTheCap) {
+    std::vector<float> xs;
+    std::vector<float> ys;
+    for (int i = 0; i < 400; ++i) {
+        xs.push_back(static_cast<float>((i * 37) % 1000));
+        ys.push_back(static_cast<float>((i * 91) % 700));
+    }
+
+    SpatialGrid grid;
+    grid.Build(xs.data(), ys.data(), xs.size(), 60.0f);
+
+    for (uint32_t i = 0; i < xs.size(); ++i) {
+        std::vector<uint32_t> found;
+        grid.QueryNeighbors(i, xs.size(), [&](uint32_t j) {
+            found.push_back(j);
+            return true;
+        });
+
+        for (uint32_t j = 0; j < xs.size(); ++j) {
+            float dx = xs[i] - xs[j];
+            float dy = ys[i] - ys[j];
+            bool shouldFind = j != i && dx * dx + dy * dy < 60.0f * 60.0f;
+            if (shouldFind) {
+                EXPECT_NE(std::find(found.begin(), found.end(), j), found.end());
+            }
+        }
+        EXPECT_EQ(std::find(found.begin(), found.end(), i), found.end());
+    }
+
+    int calls = 0;
+    grid.QueryNeighbors(0, 3, [&calls](uint32_t) {
+        calls++;
+        return true;
+    });
+    EXPECT_LE(calls, 3);
+}
+
+TEST(SpatialGridTest, EmptyGridReportsNothing) {
+    SpatialGrid grid;
+    grid.Build(nullptr, nullptr, 0, 50.0f);
+
+    int calls = 0;
+    grid.QueryRadius(0.0f, 0.0f, 1000.0f, [&calls](uint32_t) { calls++; });
+
+    EXPECT_EQ(calls, 0);
+}
+
+class AutoPlayerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        game = std::make_unique<Game>(GameServices::CreateInMemory(42));
+        game->Initialize(1920.0f, 1080.0f);
+    }
+    std::unique_ptr<Game> game;
+};
+
+TEST_F(AutoPlayerTest, MostHPPolicyTargetsDensestCluster) {
+    game->SpawnNode(CreateTestSpawnInfo(300.0f, 300.0f));
+    game->SpawnNode(CreateTestSpawnInfo(1500.0f, 800.0f));
+    game->SpawnNode(CreateTestSpawnInfo(1510.0f, 805.0f));
+    game->SpawnNode(CreateTestSpawnInfo(1505.0f, 795.0f));
+
+    AutoPlayer player(AutoPlayerPolicy::MostHPInZone);
+    Position target = player.ChooseTarget(*game);
+
+    EXPECT_NEAR(target.x, 1505.0f, 20.0f);
+    EXPECT_NEAR(target.y, 800.0f, 20.0f);
+}
+
+TEST_F(AutoPlayerTest, PickupPolicyTargetsPickups) {
+    game->GetPickupService().SpawnPointPickups(Position{400.0f, 700.0f}, 6, 1);
+
+    AutoPlayer player(AutoPlayerPolicy::NearestPickupCluster);
+    Position target = player.ChooseTarget(*game);
+
+    EXPECT_NEAR(target.x, 400.0f, 150.0f);
+    EXPECT_NEAR(target.y, 700.0f, 150.0f);
+}
+
+TEST_F(AutoPlayerTest, CursorMovesAtCappedSpeed) {
+    game->SpawnNode(CreateTestSpawnInfo(1800.0f, 540.0f));
+
+    AutoPlayer player(AutoPlayerPolicy::MostHPInZone);
+    player.SetCursorSpeed(100.0f);
+    Position cursor = player.Update(*game, 1.0f);
+
+    EXPECT_NEAR(cursor.x, 1060.0f, 0.01f);
+    EXPECT_NEAR(cursor.y, 540.0f, 0.01f);
+    EXPECT_FLOAT_EQ(game->GetMousePosition().x, cursor.x);
+}
@@ -22,6 +22,12 @@ class EventLogger : public IObserver {
             case EventType::NodeDestroyed:
                 HandleNodeDestroyed(gameEvent);
                 break;
+            case EventType::NodesSpawned:
+                HandleNodesSpawned(gameEvent);
+                break;
+            case EventType::NodesDestroyed:
+                HandleNodesDestroyed(gameEvent);
+                break;
             case EventType::NodeDamaged:
                 HandleNodeDamaged(gameEvent);
                 break;
@@ -34,6 +40,9 @@ class EventLogger : public IObserver {
             case EventType::LevelCompleted:
                 HandleLevelCompleted(gameEvent);
                 break;
+            case EventType::ProjectilesHit:
+                HandleProjectilesHit(gameEvent);
+                break;
             default:
                 break;
         }
@@ -57,6 +66,17 @@ class EventLogger : public IObserver {
                   << std::endl;
     }
 
+    void HandleNodesSpawned(const std::shared_ptr<GameEvent>& event) {
+        std::cout << "[EVENT] " << event->count << " nodes spawned"
+                  << std::endl;
+    }
+
+    void HandleNodesDestroyed(const std::shared_ptr<GameEvent>& event) {
+        std::cout << "[EVENT] " << event->count << " nodes destroyed"
+                  << " | Points gained: " << event->points
+                  << std::endl;
+    }
+
     void HandleNodeDamaged(const std::shared_ptr<GameEvent>& event) {
         std::cout << "[EVENT] Node damaged | Damage: " << event->damage
                   << " | Remaining HP: " << event->hp
@@ -75,6 +95,11 @@ class EventLogger : public IObserver {
                   << std::endl;
     }
 
+    void HandleProjectilesHit(const std::shared_ptr<GameEvent>& event) {
+        std::cout << "[EVENT] " << event->count << " projectiles hit"
+                  << std::endl;
+    }
+
     void HandleLevelCompleted(const std::shared_ptr<GameEvent>& event) {
         std::cout << "[EVENT] Level completed | Old Level: " << event->level
                   << " | New Level: " << event->nextLevel
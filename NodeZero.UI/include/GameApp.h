@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "Enums/GameMode.h"
 #include "Enums/GameScreen.h"
 #include "raylib.h"
 
@@ -12,10 +13,12 @@ class PauseScreen;
 class UpgradesScreen;
 class LevelCompletedScreen;
 class GameoverScreen;
+class SimulationThread;
 
 class GameApp {
    public:
-    GameApp();
+    // With rewind on, the game records its recent history and the pause screen can step through it.
+    explicit GameApp(bool autoPlay = false, bool rewind = false);
     ~GameApp();
 
     void Run();
@@ -26,18 +29,27 @@ class GameApp {
     void Draw();
     void Cleanup();
 
+    // Leaving gameplay pauses the simulation thread so other screens can use the game directly.
     void ChangeState(GameScreen newState);
+    // Switching modes starts a fresh run; the same mode continues where it was.
+    void StartGame(GameMode mode);
+    // The checkpoint is loaded on the way into gameplay, after health is set up for a new run.
+    void ResumeRun();
 
     // Game Screen
     GameScreen m_CurrentState;
     GameScreen m_PreviousState;
     bool m_ShouldClose;
+    bool m_AutoPlay;
+    bool m_Rewind;
+    bool m_ResumePending;
 
     // Core Systems
     std::unique_ptr<IGame> m_Game;
+    std::unique_ptr<SimulationThread> m_SimulationThread;
 
     // Screens
-    std::shared_ptr<GameplayScreen> m_GameplayScreen;
+    std::unique_ptr<GameplayScreen> m_GameplayScreen;
     std::unique_ptr<MainScreen> m_MainScreen;
     std::unique_ptr<PauseScreen> m_PauseScreen;
     std::unique_ptr<UpgradesScreen> m_UpgradesScreen;
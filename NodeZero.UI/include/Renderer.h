@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
+#include "Config/NodeArchetypes.h"
 #include "raylib.h"
 
 class Renderer {
@@ -7,9 +11,18 @@ class Renderer {
     static void DrawCircleNode(float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
     static void DrawSquareNode(float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
     static void DrawHexagonNode(float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
+    static void DrawNode(NodeRenderRoutine routine, float x, float y, float size, float hpPercentage, Color color, float rotation = 0.0f);
+    static Color ToColor(NodeColor color);
     static void DrawPickup(float x, float y, float size, Color color);
+    // Merged pickups grow and gain a ring with the number of points they carry.
+    static void DrawPickupAggregate(float x, float y, float size, int points, Color color);
+    // Draws every live slot of a projectile pool as a diamond in a single vertex batch.
+    // A null alive column draws all count positions.
+    static void DrawProjectiles(const float* xs, const float* ys, const uint8_t* alive, size_t count, float radius, Color color);
 
     static void DrawDebugInfo(int posX, int posY, Font font);
+    // Right-aligned at posX: live node count and the cost of a tick and a frame per node.
+    static void DrawEntityCost(size_t nodeCount, double simMilliseconds, double renderMilliseconds, int posX, int posY, Font font);
     static void DrawPoints(int points, int posX, int posY, int fontSize, Color color, Font font);
     static void DrawHealthBar(float health, float maxHealth, int posX, int posY, int width, int height, Font font);
     static void DrawProgressBar(float percentage, int currentLevel, Font font);
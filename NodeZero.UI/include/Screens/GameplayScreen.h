@@ -5,10 +5,12 @@
 #include <vector>
 
 #include "Enums/GameScreen.h"
-#include "Events/IObserver.h"
 #include "IGame.h"
+#include "Types/WorldSnapshot.h"
 #include "raylib.h"
 
+class SimulationThread;
+
 struct PickupCollectEffect {
     Vector2 startPosition;
     float elapsed;
@@ -25,18 +27,22 @@ struct DamageParticle {
     Color color;
 };
 
-class GameplayScreen : public IObserver, public std::enable_shared_from_this<GameplayScreen> {
+// Draws the newest snapshot from the simulation thread and sends it the cursor. The game
+// itself is only touched once the simulation has paused for a game over.
+class GameplayScreen {
    public:
-    GameplayScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font);
+    GameplayScreen(IGame& game, SimulationThread& simulation, std::function<void(GameScreen)> stateChangeCallback, Font font);
 
     void Update(float deltaTime);
     void Draw();
     void ClearEffects();
-
-    void Update(const std::shared_ptr<IEvent>& event) override;
+    // Draws this frame instead of the newest snapshot until cleared with nullptr.
+    void SetReplayFrame(const WorldSnapshot* frame);
 
    private:
     IGame& m_Game;
+    SimulationThread& m_Simulation;
+    const WorldSnapshot* m_ReplayFrame;
     std::function<void(GameScreen)> m_StateChangeCallback;
     std::vector<PickupCollectEffect> m_PickupEffects;
     std::vector<DamageParticle> m_DamageParticles;
@@ -45,18 +51,23 @@ class GameplayScreen : public IObserver, public std::enable_shared_from_this<Gam
     static constexpr size_t MAX_PARTICLES = 500;
     static constexpr size_t MAX_PICKUP_EFFECTS = 100;
 
+    // Smoothed wall-clock cost of a simulation tick and of Draw, shown in Overload mode
+    double m_SimMilliseconds;
+    double m_RenderMilliseconds;
+
     float m_ShakeIntensity;
     float m_ShakeDuration;
     float m_ShakeTimer;
     Vector2 m_ShakeOffset;
 
+    void HandleEvent(const SnapshotEvent& event);
     void TriggerShake(float intensity, float duration);
     void UpdateShake(float deltaTime);
     void SpawnDamageParticles(Vector2 position, Color baseColor, int count);
     void UpdateParticles(float deltaTime);
 
-    void DrawReflections(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize, float reflectionOffset);
-    void DrawBloom(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize);
+    void DrawReflections(const std::vector<NodeSnapshot>& nodes, Vector2 mousePos, float damageZoneSize, float reflectionOffset);
+    void DrawBloom(const std::vector<NodeSnapshot>& nodes, Vector2 mousePos, float damageZoneSize);
 
     static constexpr float PICKUP_COLLECT_EFFECT_DURATION = 1.0f;
     static constexpr float PICKUP_SPAWN_ANIM_DURATION = 0.45f;
@@ -66,4 +77,5 @@ class GameplayScreen : public IObserver, public std::enable_shared_from_this<Gam
     static constexpr float PARTICLE_SPEED_MIN = 50.0f;
     static constexpr float PARTICLE_SPEED_MAX = 150.0f;
     static constexpr int PARTICLE_COUNT = 8;
+    static constexpr double COST_SMOOTHING = 0.1;
 };
@@ -2,19 +2,27 @@
 
 #include <functional>
 
+#include "Enums/GameMode.h"
 #include "Enums/GameScreen.h"
 #include "Widgets/Menu.h"
 #include "raylib.h"
 
 class MainScreen {
    public:
-    MainScreen(std::function<void(GameScreen)> stateChangeCallback, Font font);
+    MainScreen(std::function<void(GameScreen)> stateChangeCallback, std::function<void(GameMode)> startGameCallback, std::function<void()> resumeCallback, Font font);
 
     void Update(float deltaTime);
     void Draw();
+    // Shows the Resume button above the others while a checkpoint is waiting.
+    void SetCanResume(bool canResume);
 
    private:
+    void BuildMenu();
+
     std::unique_ptr<Menu> m_Menu;
     std::function<void(GameScreen)> m_StateChangeCallback;
+    std::function<void(GameMode)> m_StartGameCallback;
+    std::function<void()> m_ResumeCallback;
     Font m_Font;
+    bool m_CanResume;
 };
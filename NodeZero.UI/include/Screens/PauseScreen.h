@@ -4,6 +4,7 @@
 
 #include "Enums/GameScreen.h"
 #include "IGame.h"
+#include "Types/WorldSnapshot.h"
 #include "Widgets/Menu.h"
 #include "raylib.h"
 
@@ -13,9 +14,16 @@ class PauseScreen {
 
     void Update(float deltaTime);
     void Draw();
+    // The recorded frame being stepped through with the arrow keys, or nullptr at the newest one.
+    const WorldSnapshot* GetRewindFrame() const;
 
    private:
+    void ReturnToGame();
+
     std::unique_ptr<Menu> m_Menu;
     IGame& m_Game;
     std::function<void(GameScreen)> m_StateChangeCallback;
+    Font m_Font;
+    WorldSnapshot m_RewindFrame;
+    bool m_ShowingRewind;
 };
@@ -1,7 +1,19 @@
+#include <cstring>
+
 #include "GameApp.h"
 
-int main() {
-    GameApp app;
+int main(int argc, char** argv) {
+    bool autoPlay = false;
+    bool rewind = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--autoplay") == 0) {
+            autoPlay = true;
+        } else if (std::strcmp(argv[i], "--rewind") == 0) {
+            rewind = true;
+        }
+    }
+
+    GameApp app(autoPlay, rewind);
     app.Run();
     return 0;
 }
@@ -15,12 +15,18 @@
 #include "Screens/MainScreen.h"
 #include "Screens/PauseScreen.h"
 #include "Screens/UpgradesScreen.h"
+#include "Services/ICheckpointService.h"
+#include "Services/IRewindService.h"
+#include "Simulation/SimulationThread.h"
 #include "raymath.h"
 
-GameApp::GameApp()
+GameApp::GameApp(bool autoPlay, bool rewind)
     : m_CurrentState(GameScreen::MainMenu),
       m_PreviousState(GameScreen::MainMenu),
       m_ShouldClose(false),
+      m_AutoPlay(autoPlay),
+      m_Rewind(rewind),
+      m_ResumePending(false),
       m_ElapsedTime(0.0f),
       m_ResolutionLoc(0),
       m_TimeLoc(0) {
@@ -53,24 +59,31 @@ void GameApp::Initialize() {
     // Initialize Game
     m_Game = std::make_unique<Game>();
     m_Game->Initialize(static_cast<float>(screenWidth), static_cast<float>(screenHeight));
+    m_Game->GetRewindService().SetEnabled(m_Rewind);
 
     // Observer Logger
     auto eventLogger = std::make_shared<EventLogger>();
     m_Game->Attach(eventLogger);
 
+    m_SimulationThread = std::make_unique<SimulationThread>(*m_Game);
+    m_SimulationThread->SetAutoPlay(m_AutoPlay);
+    m_SimulationThread->Start();
+
     // Initialize Screens
     auto stateChangeCallback = [this](GameScreen newState) { ChangeState(newState); };
 
-    m_MainScreen = std::make_unique<MainScreen>(stateChangeCallback, m_Font);
-    m_GameplayScreen = std::make_shared<GameplayScreen>(*m_Game, stateChangeCallback, m_Font);
+    auto startGameCallback = [this](GameMode mode) { StartGame(mode); };
+
+    auto resumeCallback = [this]() { ResumeRun(); };
+
+    m_MainScreen = std::make_unique<MainScreen>(stateChangeCallback, startGameCallback, resumeCallback, m_Font);
+    m_MainScreen->SetCanResume(m_Game->GetCheckpointService().HasCheckpoint());
+    m_GameplayScreen = std::make_unique<GameplayScreen>(*m_Game, *m_SimulationThread, stateChangeCallback, m_Font);
     m_PauseScreen = std::make_unique<PauseScreen>(*m_Game, stateChangeCallback, m_Font);
     m_UpgradesScreen = std::make_unique<UpgradesScreen>(*m_Game, stateChangeCallback, m_Font);
     m_LevelCompletedScreen = std::make_unique<LevelCompletedScreen>(*m_Game, stateChangeCallback, m_Font);
     m_GameoverScreen = std::make_unique<GameoverScreen>(*m_Game, stateChangeCallback, m_Font);
 
-    // Attach GameplayScreen as observer to receive game events
-    m_Game->Attach(m_GameplayScreen);
-
     // CRT Shader setup
     m_RenderTarget = LoadRenderTexture(screenWidth, screenHeight);
     SetTextureWrap(m_RenderTarget.texture, TEXTURE_WRAP_CLAMP);
@@ -85,9 +98,25 @@ void GameApp::Initialize() {
 }
 
 void GameApp::ChangeState(GameScreen newState) {
+    if (m_CurrentState == GameScreen::Playing && newState != GameScreen::Playing) {
+        m_SimulationThread->Pause();
+    }
     m_CurrentState = newState;
 }
 
+void GameApp::StartGame(GameMode mode) {
+    if (m_Game->GetGameMode() != mode) {
+        m_Game->SetGameMode(mode);
+        m_Game->Reset();
+    }
+    ChangeState(GameScreen::Playing);
+}
+
+void GameApp::ResumeRun() {
+    m_ResumePending = true;
+    ChangeState(GameScreen::Playing);
+}
+
 void GameApp::Run() {
     Initialize();
 
@@ -111,6 +140,13 @@ void GameApp::Update() {
         m_Game->GetHealthService().SetMaxHealth(m_Game->GetUpgradeService().GetMaxHealth());
         m_Game->GetHealthService().SetRegenRate(m_Game->GetUpgradeService().GetRegenRate());
         m_Game->GetHealthService().RestoreToMax();
+        if (m_ResumePending) {
+            m_ResumePending = false;
+            m_Game->ResumeFromCheckpoint();
+        }
+        // Any run started from here on replaces the checkpoint
+        m_MainScreen->SetCanResume(false);
+        m_SimulationThread->Resume();
     } else if (m_CurrentState != GameScreen::Playing && m_PreviousState == GameScreen::Playing) {
         ShowCursor();
     }
@@ -145,6 +181,7 @@ void GameApp::Draw() {
     ClearBackground(Color{40, 40, 40, 255});
 
     if (m_CurrentState == GameScreen::Playing || m_CurrentState == GameScreen::Paused || m_CurrentState == GameScreen::LevelCompleted || m_CurrentState == GameScreen::GameOver) {
+        m_GameplayScreen->SetReplayFrame(m_CurrentState == GameScreen::Paused ? m_PauseScreen->GetRewindFrame() : nullptr);
         m_GameplayScreen->Draw();
     }
 
@@ -187,6 +224,9 @@ void GameApp::Draw() {
 }
 
 void GameApp::Cleanup() {
+    if (m_SimulationThread) {
+        m_SimulationThread->Stop();
+    }
     UnloadFont(m_Font);
     UnloadShader(m_CrtShader);
     UnloadRenderTexture(m_RenderTarget);
@@ -1,10 +1,13 @@
 #include "Renderer.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <string>
 #include <vector>
 
 #include "raymath.h"
+#include "rlgl.h"
 
 void Renderer::DrawCircleNode(float x, float y, float size, float hpPercentage, Color color, float rotation) {
     const int sides = 32;
@@ -157,12 +160,62 @@ void Renderer::DrawHexagonNode(float x, float y, float size, float hpPercentage,
     DrawPolyLinesEx(Vector2{x, y}, sides, size, rotation, borderThickness, color);
 }
 
+void Renderer::DrawNode(NodeRenderRoutine routine, float x, float y, float size, float hpPercentage, Color color, float rotation) {
+    using DrawFunction = void (*)(float, float, float, float, Color, float);
+    static constexpr DrawFunction ROUTINES[] = {
+        &Renderer::DrawCircleNode,
+        &Renderer::DrawSquareNode,
+        &Renderer::DrawHexagonNode,
+    };
+
+    ROUTINES[static_cast<int>(routine)](x, y, size, hpPercentage, color, rotation);
+}
+
+Color Renderer::ToColor(NodeColor color) {
+    return Color{color.r, color.g, color.b, color.a};
+}
+
 void Renderer::DrawPickup(float x, float y, float size, Color color) {
     float thickness = GetScreenHeight() * 0.002f;
     DrawLineEx(Vector2{x - size, y}, Vector2{x + size, y}, thickness, color);
     DrawLineEx(Vector2{x, y - size}, Vector2{x, y + size}, thickness, color);
 }
 
+void Renderer::DrawPickupAggregate(float x, float y, float size, int points, Color color) {
+    float scale = 1.0f + std::min(2.0f, std::log2(static_cast<float>(points)) * 0.35f);
+    DrawPickup(x, y, size * scale, color);
+    DrawCircleLinesV(Vector2{x, y}, size * scale * 0.75f, color);
+}
+
+void Renderer::DrawProjectiles(const float* xs, const float* ys, const uint8_t* alive, size_t count, float radius, Color color) {
+    const size_t chunk = 1024;
+    const int verticesPerProjectile = 6;
+
+    for (size_t first = 0; first < count; first += chunk) {
+        size_t last = std::min(count, first + chunk);
+        rlCheckRenderBatchLimit(static_cast<int>(last - first) * verticesPerProjectile);
+
+        rlBegin(RL_TRIANGLES);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (size_t i = first; i < last; ++i) {
+            if (alive && !alive[i]) {
+                continue;
+            }
+
+            float x = xs[i];
+            float y = ys[i];
+            rlVertex2f(x, y - radius);
+            rlVertex2f(x - radius, y);
+            rlVertex2f(x, y + radius);
+
+            rlVertex2f(x, y - radius);
+            rlVertex2f(x, y + radius);
+            rlVertex2f(x + radius, y);
+        }
+        rlEnd();
+    }
+}
+
 void Renderer::DrawDebugInfo(int posX, int posY, Font font) {
     std::string fpsText = "FPS: " + std::to_string(GetFPS());
     int fontSize = static_cast<int>(GetScreenHeight() * 0.025f);
@@ -171,6 +224,21 @@ void Renderer::DrawDebugInfo(int posX, int posY, Font font) {
     DrawTextEx(font, fpsText.c_str(), Vector2{alignedX, static_cast<float>(posY)}, static_cast<float>(fontSize), 1, WHITE);
 }
 
+void Renderer::DrawEntityCost(size_t nodeCount, double simMilliseconds, double renderMilliseconds, int posX, int posY, Font font) {
+    double perNode = nodeCount > 0 ? 1e6 / static_cast<double>(nodeCount) : 0.0;
+    char lines[3][64];
+    snprintf(lines[0], sizeof(lines[0]), "Nodes: %zu", nodeCount);
+    snprintf(lines[1], sizeof(lines[1]), "Sim: %.2f ms (%.0f ns/node)", simMilliseconds, simMilliseconds * perNode);
+    snprintf(lines[2], sizeof(lines[2]), "Render: %.2f ms (%.0f ns/node)", renderMilliseconds, renderMilliseconds * perNode);
+
+    int fontSize = static_cast<int>(GetScreenHeight() * 0.025f);
+    for (int i = 0; i < 3; ++i) {
+        Vector2 textSize = MeasureTextEx(font, lines[i], static_cast<float>(fontSize), 1);
+        float y = static_cast<float>(posY + i * fontSize * 1.2f);
+        DrawTextEx(font, lines[i], Vector2{posX - textSize.x, y}, static_cast<float>(fontSize), 1, Color{255, 200, 80, 255});
+    }
+}
+
 void Renderer::DrawPoints(int points, int posX, int posY, int fontSize, Color color, Font font) {
     std::string pointsText = "Points: " + std::to_string(points);
     DrawTextEx(font, pointsText.c_str(), Vector2{static_cast<float>(posX), static_cast<float>(posY)}, static_cast<float>(fontSize), 1, color);
@@ -4,32 +4,28 @@
 #include <cmath>
 #include <cstdlib>
 
-#include "Events/GameEvents.h"
-#include "INode.h"
+#include "Config/NodeArchetypes.h"
 #include "InputHandler.h"
 #include "Renderer.h"
-#include "Services/IHealthService.h"
-#include "Services/ILevelService.h"
-#include "Services/IPickupService.h"
-#include "Services/IUpgradeService.h"
+#include "Simulation/SimulationThread.h"
 #include "raylib.h"
 #include "raymath.h"
 #include "rlgl.h"
 
-GameplayScreen::GameplayScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font)
-    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_Font(font), m_ShakeIntensity(0.0f), m_ShakeDuration(0.0f), m_ShakeTimer(0.0f), m_ShakeOffset{0.0f, 0.0f} {
+GameplayScreen::GameplayScreen(IGame& game, SimulationThread& simulation, std::function<void(GameScreen)> stateChangeCallback, Font font)
+    : m_Game(game), m_Simulation(simulation), m_ReplayFrame(nullptr), m_StateChangeCallback(stateChangeCallback), m_Font(font), m_SimMilliseconds(0.0), m_RenderMilliseconds(0.0), m_ShakeIntensity(0.0f), m_ShakeDuration(0.0f), m_ShakeTimer(0.0f), m_ShakeOffset{0.0f, 0.0f} {
     m_DamageParticles.reserve(MAX_PARTICLES);
     m_PickupEffects.reserve(MAX_PICKUP_EFFECTS);
 }
 
-void GameplayScreen::Update(const std::shared_ptr<IEvent>& event) {
-    auto gameEvent = std::static_pointer_cast<GameEvent>(event);
-    if (gameEvent->type == EventType::NodeDamaged) {
+void GameplayScreen::HandleEvent(const SnapshotEvent& event) {
+    if (event.type == EventType::NodeDamaged) {
         TriggerShake(SHAKE_INTENSITY, SHAKE_DURATION);
 
-        Position nodePos = gameEvent->position;
-        Vector2 particlePos = {nodePos.x, nodePos.y};
+        Vector2 particlePos = {event.position.x, event.position.y};
         SpawnDamageParticles(particlePos, RED, PARTICLE_COUNT);
+    } else if (event.type == EventType::ProjectilesHit) {
+        TriggerShake(SHAKE_INTENSITY * 2.0f, SHAKE_DURATION);
     }
 }
 
@@ -120,37 +116,20 @@ void GameplayScreen::ClearEffects() {
     m_ShakeOffset = Vector2{0.0f, 0.0f};
 }
 
-void GameplayScreen::DrawReflections(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize, float reflectionOffset) {
-    for (const INode* node : nodes) {
-        if (node->GetState() == NodeState::Active) {
-            float x = node->GetPosition().x + reflectionOffset;
-            float y = node->GetPosition().y + reflectionOffset;
-            float size = node->GetSize();
-            float hpPercentage = node->GetHP() / node->GetMaxHP();
-            float rotation = node->GetRotation();
-
-            Color reflectionColor = RED;
-            if (node->GetShape() == NodeShape::Boss) reflectionColor = Color{200, 50, 200, 255};
-            reflectionColor.a = 5;
-
-            switch (node->GetShape()) {
-                case NodeShape::Circle:
-                    Renderer::DrawCircleNode(x, y, size, hpPercentage, reflectionColor, rotation);
-                    break;
-                case NodeShape::Square:
-                    Renderer::DrawSquareNode(x, y, size, hpPercentage, reflectionColor, rotation);
-                    break;
-                case NodeShape::Hexagon:
-                    Renderer::DrawHexagonNode(x, y, size, hpPercentage, reflectionColor, rotation);
-                    break;
-                case NodeShape::Boss:
-                    Renderer::DrawSquareNode(x, y, size, hpPercentage, reflectionColor, rotation);
-                    break;
-                default:
-                    Renderer::DrawCircleNode(x, y, size, hpPercentage, reflectionColor, rotation);
-                    break;
-            }
-        }
+void GameplayScreen::SetReplayFrame(const WorldSnapshot* frame) {
+    m_ReplayFrame = frame;
+}
+
+void GameplayScreen::DrawReflections(const std::vector<NodeSnapshot>& nodes, Vector2 mousePos, float damageZoneSize, float reflectionOffset) {
+    for (const NodeSnapshot& node : nodes) {
+        float x = node.x + reflectionOffset;
+        float y = node.y + reflectionOffset;
+
+        const NodeArchetype& archetype = NodeArchetypes::Get(node.shape);
+        Color reflectionColor = Renderer::ToColor(archetype.color);
+        reflectionColor.a = 5;
+
+        Renderer::DrawNode(archetype.renderRoutine, x, y, node.size, node.hp / node.maxHp, reflectionColor, node.rotation);
     }
 
     // Draw damage zone reflection
@@ -186,20 +165,13 @@ void GameplayScreen::DrawReflections(const std::vector<INode*>& nodes, Vector2 m
     DrawLineEx(Vector2{rRight, rBottom}, Vector2{rRight, rBottom - cornerLength}, cornerThickness, reflectionCornerColor);
 }
 
-void GameplayScreen::DrawBloom(const std::vector<INode*>& nodes, Vector2 mousePos, float damageZoneSize) {
+void GameplayScreen::DrawBloom(const std::vector<NodeSnapshot>& nodes, Vector2 mousePos, float damageZoneSize) {
     // Draw bloom for nodes
-    for (const INode* node : nodes) {
-        if (node->GetState() == NodeState::Active) {
-            float x = node->GetPosition().x;
-            float y = node->GetPosition().y;
-            float size = node->GetSize();
-
-            Color glowColor = RED;
-            if (node->GetShape() == NodeShape::Boss) glowColor = Color{200, 50, 200, 255};
+    for (const NodeSnapshot& node : nodes) {
+        Color glowColor = Renderer::ToColor(NodeArchetypes::Get(node.shape).color);
 
-            glowColor.a = 40;
-            DrawCircleGradient(static_cast<int>(x), static_cast<int>(y), size * 2.0f, glowColor, Fade(glowColor, 0.0f));
-        }
+        glowColor.a = 40;
+        DrawCircleGradient(static_cast<int>(node.x), static_cast<int>(node.y), node.size * 2.0f, glowColor, Fade(glowColor, 0.0f));
     }
 
     // Draw bloom for damage zone
@@ -209,31 +181,40 @@ void GameplayScreen::DrawBloom(const std::vector<INode*>& nodes, Vector2 mousePo
 
 void GameplayScreen::Update(float deltaTime) {
     Vector2 mousePos = InputHandler::GetMousePosition();
-    m_Game.SetMousePosition(mousePos.x, mousePos.y);
+    m_Simulation.PushInput(SimulationInput{mousePos.x, mousePos.y});
 
-    m_Game.Update(deltaTime);
+    bool fresh = m_Simulation.AcquireSnapshot();
+    const WorldSnapshot& snapshot = m_Simulation.GetSnapshot();
+    m_SimMilliseconds += (snapshot.tickMilliseconds - m_SimMilliseconds) * COST_SMOOTHING;
 
     UpdateShake(deltaTime);
     UpdateParticles(deltaTime);
 
-    if (m_Game.GetHealthService().IsZero()) {
-        m_Game.SaveProgress();
+    if (snapshot.healthDepleted) {
+        // Changing state pauses the simulation, after which the game is ours to save
         m_StateChangeCallback(GameScreen::GameOver);
+        m_Game.EndRun();
         return;
     }
 
-    std::vector<PointPickup> collectedPickups = m_Game.GetCollectedPickupsThisFrame();
-    for (const PointPickup& pickup : collectedPickups) {
-        if (m_PickupEffects.size() >= MAX_PICKUP_EFFECTS) {
-            break;
+    // A snapshot's events and collections are only new the frame it is taken
+    if (fresh) {
+        for (const SnapshotEvent& event : snapshot.events) {
+            HandleEvent(event);
         }
 
-        PickupCollectEffect effect{};
-        effect.startPosition = Vector2{pickup.position.x, pickup.position.y};
-        effect.elapsed = 0.0f;
-        effect.duration = PICKUP_COLLECT_EFFECT_DURATION;
-        effect.size = pickup.size;
-        m_PickupEffects.push_back(effect);
+        for (const PickupSnapshot& pickup : snapshot.collectedPickups) {
+            if (m_PickupEffects.size() >= MAX_PICKUP_EFFECTS) {
+                break;
+            }
+
+            PickupCollectEffect effect{};
+            effect.startPosition = Vector2{pickup.position.x, pickup.position.y};
+            effect.elapsed = 0.0f;
+            effect.duration = PICKUP_COLLECT_EFFECT_DURATION;
+            effect.size = pickup.size;
+            m_PickupEffects.push_back(effect);
+        }
     }
 
     size_t writeIndex = 0;
@@ -251,7 +232,7 @@ void GameplayScreen::Update(float deltaTime) {
 
     m_PickupEffects.resize(writeIndex);
 
-    if (m_Game.GetLevelService().IsLevelCompleted()) {
+    if (snapshot.levelCompleted) {
         m_StateChangeCallback(GameScreen::LevelCompleted);
         return;
     }
@@ -262,57 +243,40 @@ void GameplayScreen::Update(float deltaTime) {
 }
 
 void GameplayScreen::Draw() {
+    double drawStart = GetTime();
     rlPushMatrix();
     rlTranslatef(m_ShakeOffset.x, m_ShakeOffset.y, 0.0f);
 
-    Vector2 mousePos = InputHandler::GetMousePosition();
-    float damageZoneSize = m_Game.GetUpgradeService().GetDamageZoneSize();
+    const WorldSnapshot& snapshot = m_ReplayFrame ? *m_ReplayFrame : m_Simulation.GetSnapshot();
+    Vector2 mousePos{snapshot.zoneCenter.x, snapshot.zoneCenter.y};
+    float damageZoneSize = snapshot.damageZoneSize;
     float damageRectX = mousePos.x - damageZoneSize / 2.0f;
     float damageRectY = mousePos.y - damageZoneSize / 2.0f;
 
-    const auto& nodes = m_Game.GetNodes();
+    const auto& nodes = snapshot.nodes;
 
     // Apply visual effects (reflections and bloom)
     float reflectionOffset = GetScreenHeight() * 0.02f;
     DrawReflections(nodes, mousePos, damageZoneSize, reflectionOffset);
     DrawBloom(nodes, mousePos, damageZoneSize);
 
-    for (const INode* node : nodes) {
-        if (node->GetState() == NodeState::Active) {
-            float x = node->GetPosition().x;
-            float y = node->GetPosition().y;
-            float size = node->GetSize();
-            float hpPercentage = node->GetHP() / node->GetMaxHP();
-            float rotation = node->GetRotation();
-
-            switch (node->GetShape()) {
-                case NodeShape::Circle:
-                    Renderer::DrawCircleNode(x, y, size, hpPercentage, RED, rotation);
-                    break;
-                case NodeShape::Square:
-                    Renderer::DrawSquareNode(x, y, size, hpPercentage, RED, rotation);
-                    break;
-                case NodeShape::Hexagon:
-                    Renderer::DrawHexagonNode(x, y, size, hpPercentage, RED, rotation);
-                    break;
-                case NodeShape::Boss:
-                    Renderer::DrawSquareNode(x, y, size, hpPercentage, Color{200, 50, 200, 255}, rotation);
-                    break;
-                default:
-                    Renderer::DrawCircleNode(x, y, size, hpPercentage, RED, rotation);
-                    break;
-            }
-        }
+    for (const NodeSnapshot& node : nodes) {
+        const NodeArchetype& archetype = NodeArchetypes::Get(node.shape);
+        Renderer::DrawNode(archetype.renderRoutine, node.x, node.y, node.size, node.hp / node.maxHp, Renderer::ToColor(archetype.color), node.rotation);
+    }
+
+    if (!snapshot.projectileXs.empty()) {
+        Renderer::DrawProjectiles(snapshot.projectileXs.data(), snapshot.projectileYs.data(), nullptr,
+                                  snapshot.projectileXs.size(), snapshot.projectileRadius, Color{255, 140, 40, 255});
     }
 
-    const auto& pickups = m_Game.GetPickupService().GetPickups();
-    for (const PointPickup& pickup : pickups) {
-        float lifeRatio = std::clamp(pickup.GetLifeRatio(), 0.0f, 1.0f);
+    for (const PickupSnapshot& pickup : snapshot.pickups) {
+        float lifeRatio = std::clamp(pickup.lifeRatio, 0.0f, 1.0f);
         unsigned char alpha = static_cast<unsigned char>(lifeRatio * 255.0f);
         Color pickupColor = Color{255, 50, 50, alpha};
         Vector2 pickupPos{pickup.position.x, pickup.position.y};
         float pickupSize = pickup.size;
-        float spawnAge = pickup.GetAge();
+        float spawnAge = pickup.age;
         if (spawnAge < PICKUP_SPAWN_ANIM_DURATION) {
             float t = std::clamp(spawnAge / PICKUP_SPAWN_ANIM_DURATION, 0.0f, 1.0f);
             Vector2 origin{pickup.spawnOrigin.x, pickup.spawnOrigin.y};
@@ -322,7 +286,11 @@ void GameplayScreen::Draw() {
             alpha = static_cast<unsigned char>(std::min(255.0f, alpha + (1.0f - t) * 100.0f));
             pickupColor = Color{255, 80, 80, alpha};
         }
-        Renderer::DrawPickup(pickupPos.x, pickupPos.y, pickupSize, pickupColor);
+        if (pickup.points > 1) {
+            Renderer::DrawPickupAggregate(pickupPos.x, pickupPos.y, pickupSize, pickup.points, pickupColor);
+        } else {
+            Renderer::DrawPickup(pickupPos.x, pickupPos.y, pickupSize, pickupColor);
+        }
     }
 
     for (const PickupCollectEffect& effect : m_PickupEffects) {
@@ -370,22 +338,32 @@ void GameplayScreen::Draw() {
         static_cast<int>(centerSquareSize),
         WHITE);
 
-    Renderer::DrawProgressBar(m_Game.GetLevelService().GetProgressBarPercentage(), m_Game.GetLevelService().GetCurrentLevel(), m_Font);
+    bool overload = snapshot.mode == GameMode::Overload;
+    if (!overload) {
+        Renderer::DrawProgressBar(snapshot.levelProgress, snapshot.level, m_Font);
+    }
 
     int healthBarX = static_cast<int>(GetScreenWidth() * 0.01f);
     int healthBarY = static_cast<int>(GetScreenHeight() * 0.01f);
     int healthBarWidth = static_cast<int>(GetScreenWidth() * 0.2f);
     int healthBarHeight = static_cast<int>(GetScreenHeight() * 0.03f);
-    Renderer::DrawHealthBar(m_Game.GetHealthService().GetCurrent(), m_Game.GetUpgradeService().GetMaxHealth(), healthBarX, healthBarY, healthBarWidth, healthBarHeight, m_Font);
+    Renderer::DrawHealthBar(snapshot.health, snapshot.maxHealth, healthBarX, healthBarY, healthBarWidth, healthBarHeight, m_Font);
 
     int pointsX = static_cast<int>(GetScreenWidth() * 0.01f);
     int pointsY = healthBarY + healthBarHeight + static_cast<int>(GetScreenHeight() * 0.015f);
     int pointsFontSize = static_cast<int>(GetScreenHeight() * 0.025f);
-    Renderer::DrawPoints(m_Game.GetPickupService().GetPickupPoints(), pointsX, pointsY, pointsFontSize, WHITE, m_Font);
+    Renderer::DrawPoints(snapshot.pickupPoints, pointsX, pointsY, pointsFontSize, WHITE, m_Font);
 
     int debugX = GetScreenWidth() - static_cast<int>(GetScreenWidth() * 0.02f);  // 2% margin from right edge
     int debugY = static_cast<int>(GetScreenHeight() * 0.01f);
     Renderer::DrawDebugInfo(debugX, debugY, m_Font);
 
+    if (overload) {
+        // CPU time to submit the frame; the GPU finishes it asynchronously
+        m_RenderMilliseconds += ((GetTime() - drawStart) * 1000.0 - m_RenderMilliseconds) * COST_SMOOTHING;
+        int costY = debugY + static_cast<int>(GetScreenHeight() * 0.035f);
+        Renderer::DrawEntityCost(nodes.size(), m_SimMilliseconds, m_RenderMilliseconds, debugX, costY, m_Font);
+    }
+
     rlPopMatrix();
 }
@@ -4,8 +4,19 @@
 #include "Widgets/Button.h"
 #include "Widgets/Label.h"
 
-MainScreen::MainScreen(std::function<void(GameScreen)> stateChangeCallback, Font font)
-    : m_StateChangeCallback(stateChangeCallback), m_Font(font) {
+MainScreen::MainScreen(std::function<void(GameScreen)> stateChangeCallback, std::function<void(GameMode)> startGameCallback, std::function<void()> resumeCallback, Font font)
+    : m_StateChangeCallback(stateChangeCallback), m_StartGameCallback(startGameCallback), m_ResumeCallback(resumeCallback), m_Font(font), m_CanResume(false) {
+    BuildMenu();
+}
+
+void MainScreen::SetCanResume(bool canResume) {
+    if (canResume != m_CanResume) {
+        m_CanResume = canResume;
+        BuildMenu();
+    }
+}
+
+void MainScreen::BuildMenu() {
     m_Menu = std::make_unique<Menu>();
 
     const int screenWidth = GetScreenWidth();
@@ -18,29 +29,42 @@ MainScreen::MainScreen(std::function<void(GameScreen)> stateChangeCallback, Font
 
     const char* titleText = "NodeZero";
     int fontSize = static_cast<int>(screenHeight * 0.06f);
-    Vector2 textSize = MeasureTextEx(font, titleText, static_cast<float>(fontSize), 1);
+    Vector2 textSize = MeasureTextEx(m_Font, titleText, static_cast<float>(fontSize), 1);
     float titleX = screenWidth / 2.0f - textSize.x / 2.0f;
 
     auto titleLabel = std::make_unique<Label>(
         titleX,
         screenHeight * 0.3f,
         titleText,
-        font,
+        m_Font,
         fontSize,
         WHITE);
     m_Menu->AddWidget(std::move(titleLabel));
 
-    auto playButton = std::make_unique<Button>(centerX, startY, buttonWidth, buttonHeight, "Play", font);
+    if (m_CanResume) {
+        auto resumeButton = std::make_unique<Button>(centerX, startY, buttonWidth, buttonHeight, "Resume", m_Font);
+        resumeButton->SetColors(Color{50, 150, 50, 255}, Color{80, 180, 80, 255}, Color{30, 120, 30, 255}, WHITE);
+        resumeButton->SetOnClick([this]() { m_ResumeCallback(); });
+        m_Menu->AddWidget(std::move(resumeButton));
+        startY += buttonHeight + buttonSpacing;
+    }
+
+    auto playButton = std::make_unique<Button>(centerX, startY, buttonWidth, buttonHeight, "Play", m_Font);
     playButton->SetColors(Color{70, 130, 180, 255}, Color{100, 160, 210, 255}, Color{40, 100, 150, 255}, WHITE);
-    playButton->SetOnClick([this]() { m_StateChangeCallback(GameScreen::Playing); });
+    playButton->SetOnClick([this]() { m_StartGameCallback(GameMode::Standard); });
     m_Menu->AddWidget(std::move(playButton));
 
-    auto upgradesButton = std::make_unique<Button>(centerX, startY + buttonHeight + buttonSpacing, buttonWidth, buttonHeight, "Upgrades", font);
+    auto overloadButton = std::make_unique<Button>(centerX, startY + buttonHeight + buttonSpacing, buttonWidth, buttonHeight, "Overload", m_Font);
+    overloadButton->SetColors(Color{200, 120, 30, 255}, Color{230, 150, 60, 255}, Color{170, 90, 10, 255}, WHITE);
+    overloadButton->SetOnClick([this]() { m_StartGameCallback(GameMode::Overload); });
+    m_Menu->AddWidget(std::move(overloadButton));
+
+    auto upgradesButton = std::make_unique<Button>(centerX, startY + (buttonHeight + buttonSpacing) * 2, buttonWidth, buttonHeight, "Upgrades", m_Font);
     upgradesButton->SetColors(Color{50, 150, 50, 255}, Color{80, 180, 80, 255}, Color{30, 120, 30, 255}, WHITE);
     upgradesButton->SetOnClick([this]() { m_StateChangeCallback(GameScreen::Upgrades); });
     m_Menu->AddWidget(std::move(upgradesButton));
 
-    auto quitButton = std::make_unique<Button>(centerX, startY + (buttonHeight + buttonSpacing) * 2, buttonWidth, buttonHeight, "Quit", font);
+    auto quitButton = std::make_unique<Button>(centerX, startY + (buttonHeight + buttonSpacing) * 3, buttonWidth, buttonHeight, "Quit", m_Font);
     quitButton->SetColors(Color{180, 70, 70, 255}, Color{210, 100, 100, 255}, Color{150, 40, 40, 255}, WHITE);
     quitButton->SetOnClick([this]() { m_StateChangeCallback(GameScreen::Quit); });
     m_Menu->AddWidget(std::move(quitButton));
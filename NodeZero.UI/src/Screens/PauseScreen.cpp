@@ -1,11 +1,14 @@
 #include "Screens/PauseScreen.h"
 
+#include <cstdio>
+
 #include "Config/GameConfig.h"
+#include "Services/IRewindService.h"
 #include "Widgets/Button.h"
 #include "Widgets/Label.h"
 
 PauseScreen::PauseScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font)
-    : m_Game(game), m_StateChangeCallback(stateChangeCallback) {
+    : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_Font(font), m_ShowingRewind(false) {
     m_Menu = std::make_unique<Menu>();
 
     const int screenWidth = GetScreenWidth();
@@ -32,13 +35,13 @@ PauseScreen::PauseScreen(IGame& game, std::function<void(GameScreen)> stateChang
 
     auto resumeButton = std::make_unique<Button>(centerX, startY, buttonWidth, buttonHeight, "Resume", font);
     resumeButton->SetColors(Color{50, 150, 50, 255}, Color{80, 180, 80, 255}, Color{30, 120, 30, 255}, WHITE);
-    resumeButton->SetOnClick([this]() { m_StateChangeCallback(GameScreen::Playing); });
+    resumeButton->SetOnClick([this]() { ReturnToGame(); });
     m_Menu->AddWidget(std::move(resumeButton));
 
     auto terminateButton = std::make_unique<Button>(centerX, startY + buttonHeight + buttonSpacing, buttonWidth, buttonHeight, "Terminate", font);
     terminateButton->SetColors(Color{180, 50, 50, 255}, Color{210, 80, 80, 255}, Color{150, 30, 30, 255}, WHITE);
     terminateButton->SetOnClick([this]() {
-        m_Game.SaveProgress();
+        m_Game.EndRun();
         m_StateChangeCallback(GameScreen::GameOver);
     });
     m_Menu->AddWidget(std::move(terminateButton));
@@ -47,11 +50,46 @@ PauseScreen::PauseScreen(IGame& game, std::function<void(GameScreen)> stateChang
 void PauseScreen::Update(float deltaTime) {
     m_Menu->Update();
     if (IsKeyPressed(KEY_ESCAPE)) {
-        m_StateChangeCallback(GameScreen::Playing);
+        ReturnToGame();
+    }
+
+    // The simulation is paused here, so the rewind history can be read directly
+    IRewindService& rewind = m_Game.GetRewindService();
+    if (!rewind.IsEnabled()) {
+        return;
+    }
+    bool stepped = false;
+    if (IsKeyPressed(KEY_LEFT) || IsKeyPressedRepeat(KEY_LEFT)) {
+        stepped = rewind.StepBackward();
+    } else if (IsKeyPressed(KEY_RIGHT) || IsKeyPressedRepeat(KEY_RIGHT)) {
+        stepped = rewind.StepForward();
+    }
+    if (stepped) {
+        m_ShowingRewind = rewind.GetFramesBack() > 0 && rewind.ReadFrame(m_RewindFrame);
     }
 }
 
 void PauseScreen::Draw() {
     DrawRectangle(0, 0, GetScreenWidth(), GetScreenHeight(), Color{0, 0, 0, 150});
     m_Menu->Draw();
+
+    const IRewindService& rewind = m_Game.GetRewindService();
+    if (rewind.IsEnabled()) {
+        char text[96];
+        snprintf(text, sizeof(text), "REWIND -%.2fs  (%zu frames, %.1f MB)  LEFT/RIGHT to step",
+                 rewind.GetSecondsBack(), rewind.GetFrameCount(), rewind.GetMemoryUsage() / (1024.0 * 1024.0));
+        float fontSize = GetScreenHeight() * 0.025f;
+        Vector2 textSize = MeasureTextEx(m_Font, text, fontSize, 1);
+        DrawTextEx(m_Font, text, Vector2{GetScreenWidth() / 2.0f - textSize.x / 2.0f, GetScreenHeight() * 0.8f}, fontSize, 1, WHITE);
+    }
+}
+
+const WorldSnapshot* PauseScreen::GetRewindFrame() const {
+    return m_ShowingRewind ? &m_RewindFrame : nullptr;
+}
+
+void PauseScreen::ReturnToGame() {
+    m_Game.GetRewindService().SeekNewest();
+    m_ShowingRewind = false;
+    m_StateChangeCallback(GameScreen::Playing);
 }
@@ -2,9 +2,13 @@
 
 #include <cstdio>
 
+#include "Services/IRunHistoryService.h"
 #include "Services/IUpgradeService.h"
 #include "Services/ISaveService.h"
 
+// Runs in each window of the recent-points trend
+static constexpr size_t TREND_RUNS = 10;
+
 UpgradesScreen::UpgradesScreen(IGame& game, std::function<void(GameScreen)> stateChangeCallback, Font font)
     : m_Game(game), m_StateChangeCallback(stateChangeCallback), m_WasMousePressed(false), m_IsFirstFrame(true), m_Font(font) {
 }
@@ -67,6 +71,38 @@ void UpgradesScreen::Draw() {
     snprintf(damagePerTickText, sizeof(damagePerTickText), "Damage/Tick: %.0f", m_Game.GetUpgradeService().GetDamagePerTick());
     DrawTextEx(m_Font, damagePerTickText, Vector2{static_cast<float>(statsX), static_cast<float>(statsY + statsSpacing * 8)}, static_cast<float>(statTextFontSize), 1, WHITE);
 
+    // Every figure here is a fixed number of lookups, however long the history is
+    const IRunHistoryService& history = m_Game.GetRunHistoryService();
+    size_t runCount = history.GetRunCount();
+    int historyY = statsY + statsSpacing * 10;
+    DrawTextEx(m_Font, "RUN HISTORY", Vector2{static_cast<float>(statsX), static_cast<float>(historyY)}, static_cast<float>(subtitleFontSize), 1, YELLOW);
+
+    char historyLines[4][64];
+    int historyLineCount = 0;
+    if (runCount == 0) {
+        snprintf(historyLines[historyLineCount++], sizeof(historyLines[0]), "No finished runs yet");
+    } else {
+        snprintf(historyLines[historyLineCount++], sizeof(historyLines[0]), "Runs: %zu", runCount);
+        snprintf(historyLines[historyLineCount++], sizeof(historyLines[0]), "Level median / p90: %.0f / %.0f",
+                 history.GetPercentile(RunStat::LevelReached, 0.5f), history.GetPercentile(RunStat::LevelReached, 0.9f));
+        snprintf(historyLines[historyLineCount++], sizeof(historyLines[0]), "Points median / p90: %.0f / %.0f",
+                 history.GetPercentile(RunStat::Points, 0.5f), history.GetPercentile(RunStat::Points, 0.9f));
+
+        size_t recent = runCount < TREND_RUNS ? runCount : TREND_RUNS;
+        double recentPoints = history.GetAverage(RunStat::Points, runCount - recent, recent);
+        if (runCount >= TREND_RUNS * 2) {
+            double earlierPoints = history.GetAverage(RunStat::Points, runCount - TREND_RUNS * 2, TREND_RUNS);
+            snprintf(historyLines[historyLineCount++], sizeof(historyLines[0]), "Last %zu avg: %.0f pts (before: %.0f)",
+                     recent, recentPoints, earlierPoints);
+        } else {
+            snprintf(historyLines[historyLineCount++], sizeof(historyLines[0]), "Last %zu avg: %.0f pts", recent,
+                     recentPoints);
+        }
+    }
+    for (int i = 0; i < historyLineCount; ++i) {
+        DrawTextEx(m_Font, historyLines[i], Vector2{static_cast<float>(statsX), static_cast<float>(historyY + statsSpacing * (i + 1))}, static_cast<float>(statTextFontSize), 1, WHITE);
+    }
+
     int upgradeY = screenHeight / 2 - static_cast<int>(screenHeight * 0.1f);
     int upgradeTitleFontSize = static_cast<int>(screenHeight * 0.038f);
     Vector2 upgradesTitleSize = MeasureTextEx(m_Font, "UPGRADES", static_cast<float>(upgradeTitleFontSize), 1);